@@ -5,15 +5,65 @@
 
 namespace ft
 {
+    // iterator_category로 분기한다. random access iterator(포인터 포함)는 뺄셈 한 번으로 끝나고,
+    // 나머지는 한 칸씩 센다. input iterator는 이걸 부르면 범위를 다 읽어 버리므로 부른 뒤에는 다시 읽을 수 없다.
     template <typename InputIterator>
-    typename ft::iterator_traits<InputIterator>::difference_type difference(InputIterator first, InputIterator last)
+    typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last, ft::input_iterator_tag)
     {
-        typedef typename ft::iterator_traits<InputIterator>::difference_type    size_type;
-        size_type n = 0;
-        for (; first != last; first++)
+        typename ft::iterator_traits<InputIterator>::difference_type n = 0;
+        for (; first != last; ++first)
             n++;
         return n;
-    }   
+    }
+
+    template <typename RandomAccessIterator>
+    typename ft::iterator_traits<RandomAccessIterator>::difference_type distance(RandomAccessIterator first, RandomAccessIterator last, ft::random_access_iterator_tag)
+    {
+        return last - first;
+    }
+
+    // Returns the number of elements between first and last.
+    template <typename InputIterator>
+    typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last)
+    {
+        return ft::distance(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+    }
+
+    // 예전 이름. ft::distance와 같다.
+    template <typename InputIterator>
+    typename ft::iterator_traits<InputIterator>::difference_type difference(InputIterator first, InputIterator last)
+    {
+        return ft::distance(first, last);
+    }
+
+    template <typename InputIterator, typename Distance>
+    void advance(InputIterator& it, Distance n, ft::input_iterator_tag)
+    {
+        for (; n > 0; --n)
+            ++it;
+    }
+
+    template <typename BidirectionalIterator, typename Distance>
+    void advance(BidirectionalIterator& it, Distance n, ft::bidirectional_iterator_tag)
+    {
+        for (; n > 0; --n)
+            ++it;
+        for (; n < 0; ++n)
+            --it;
+    }
+
+    template <typename RandomAccessIterator, typename Distance>
+    void advance(RandomAccessIterator& it, Distance n, ft::random_access_iterator_tag)
+    {
+        it += n;
+    }
+
+    // Advances the iterator it by n element positions. n may be negative only for bidirectional and random access iterators.
+    template <typename InputIterator, typename Distance>
+    void advance(InputIterator& it, Distance n)
+    {
+        ft::advance(it, n, typename ft::iterator_traits<InputIterator>::iterator_category());
+    }
 
     template <typename T>
     void swap(T& a, T& b)
@@ -75,6 +125,170 @@ namespace ft
     
         return (first1 == last1) && (first2 != last2);
     }
+
+    template <typename T = void>
+    struct less
+    {
+        typedef T       first_argument_type;
+        typedef T       second_argument_type;
+        typedef bool    result_type;
+
+        bool operator()(const T& x, const T& y) const { return x < y; }
+    };
+
+    // transparent comparator: 두 인자의 타입이 달라도 operator<로 바로 비교한다.
+    // ft::map<std::string, int, ft::less<> >은 const char*로 검색해도 std::string을 만들지 않는다.
+    template <>
+    struct less<void>
+    {
+        typedef void is_transparent;
+
+        template <typename T, typename U>
+        bool operator()(const T& x, const U& y) const { return x < y; }
+    };
+
+    // ============================================Set operations============================================
+    // 두 범위 모두 comp(없으면 operator<) 순서로 정렬되어 있어야 한다. 둘을 한 번씩만 같이 훑으므로 O(n + m)이고,
+    // 같은 값이 양쪽에 있으면 첫 번째 범위의 것을 쓴다. 결과의 끝을 돌려준다.
+
+    // Copies the elements that are in either [first1, last1) or [first2, last2) to result, in sorted order.
+    template <class InputIt1, class InputIt2, class OutputIt, class Compare>
+    OutputIt set_union(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt result, Compare comp)
+    {
+        for (; first1 != last1; ++result)
+        {
+            if (first2 == last2)
+            {
+                for (; first1 != last1; ++first1, ++result)
+                    *result = *first1;
+                return result;
+            }
+            if (comp(*first2, *first1))
+            {
+                *result = *first2;
+                ++first2;
+            }
+            else
+            {
+                *result = *first1;
+                if (!comp(*first1, *first2))
+                    ++first2;
+                ++first1;
+            }
+        }
+        for (; first2 != last2; ++first2, ++result)
+            *result = *first2;
+        return result;
+    }
+
+    template <class InputIt1, class InputIt2, class OutputIt>
+    OutputIt set_union(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt result)
+    {
+        return ft::set_union(first1, last1, first2, last2, result, ft::less<>());
+    }
+
+    // Copies the elements of [first1, last1) that are also in [first2, last2) to result.
+    template <class InputIt1, class InputIt2, class OutputIt, class Compare>
+    OutputIt set_intersection(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt result, Compare comp)
+    {
+        while (first1 != last1 && first2 != last2)
+        {
+            if (comp(*first1, *first2))
+                ++first1;
+            else
+            {
+                if (!comp(*first2, *first1))
+                {
+                    *result = *first1;
+                    ++result;
+                    ++first1;
+                }
+                ++first2;
+            }
+        }
+        return result;
+    }
+
+    template <class InputIt1, class InputIt2, class OutputIt>
+    OutputIt set_intersection(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt result)
+    {
+        return ft::set_intersection(first1, last1, first2, last2, result, ft::less<>());
+    }
+
+    // Copies the elements of [first1, last1) that are not in [first2, last2) to result.
+    template <class InputIt1, class InputIt2, class OutputIt, class Compare>
+    OutputIt set_difference(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt result, Compare comp)
+    {
+        while (first1 != last1)
+        {
+            if (first2 == last2)
+            {
+                for (; first1 != last1; ++first1, ++result)
+                    *result = *first1;
+                return result;
+            }
+            if (comp(*first1, *first2))
+            {
+                *result = *first1;
+                ++result;
+                ++first1;
+            }
+            else
+            {
+                if (!comp(*first2, *first1))
+                    ++first1;
+                ++first2;
+            }
+        }
+        return result;
+    }
+
+    template <class InputIt1, class InputIt2, class OutputIt>
+    OutputIt set_difference(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt result)
+    {
+        return ft::set_difference(first1, last1, first2, last2, result, ft::less<>());
+    }
+
+    // Copies the elements that are in exactly one of [first1, last1) and [first2, last2) to result, in sorted order.
+    template <class InputIt1, class InputIt2, class OutputIt, class Compare>
+    OutputIt set_symmetric_difference(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt result, Compare comp)
+    {
+        while (first1 != last1)
+        {
+            if (first2 == last2)
+            {
+                for (; first1 != last1; ++first1, ++result)
+                    *result = *first1;
+                return result;
+            }
+            if (comp(*first1, *first2))
+            {
+                *result = *first1;
+                ++result;
+                ++first1;
+            }
+            else
+            {
+                if (comp(*first2, *first1))
+                {
+                    *result = *first2;
+                    ++result;
+                }
+                else
+                    ++first1;
+                ++first2;
+            }
+        }
+        for (; first2 != last2; ++first2, ++result)
+            *result = *first2;
+        return result;
+    }
+
+    template <class InputIt1, class InputIt2, class OutputIt>
+    OutputIt set_symmetric_difference(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt result)
+    {
+        return ft::set_symmetric_difference(first1, last1, first2, last2, result, ft::less<>());
+    }
 }
  
 #endif
\ No newline at end of file
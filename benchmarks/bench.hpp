@@ -0,0 +1,108 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+// benchmarks/ 아래 프로그램들이 같이 쓰는 시간 측정 / 출력 도구
+namespace bench
+{
+    inline double now_ms()
+    {
+        struct timeval tv;
+        gettimeofday(&tv, NULL);
+        return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+    }
+
+    class timer
+    {
+        private:
+            double _start;
+        public:
+            timer(): _start(now_ms()) {}
+            void reset() { _start = now_ms(); }
+            double elapsed_ms() const { return now_ms() - _start; }
+    };
+
+    // 이 thread가 CPU를 쓴 시간만 잰다. 다른 프로세스에 CPU를 뺏긴 시간(scheduler tick 한 번에 몇 ms)이 섞이지 않으므로
+    // 짧은 호출 하나하나의 최댓값을 볼 때 쓴다.
+    class cpu_timer
+    {
+        private:
+            double _start;
+
+            static double now_ms()
+            {
+                struct timespec ts;
+                clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+                return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+            }
+        public:
+            cpu_timer(): _start(now_ms()) {}
+            double elapsed_ms() const { return now_ms() - _start; }
+    };
+
+    // 컴파일러가 측정 대상 코드를 지워버리지 않도록 결과를 흘려보내는 곳
+    static volatile long sink;
+
+    // 첫 실행은 page fault와 malloc 워밍업 비용이 섞이므로 여러 번 돌려서 가장 빠른 값을 쓴다.
+    template <typename Arg>
+    double best_of(double (*run)(const Arg&), const Arg& arg, int runs = 3)
+    {
+        double best = run(arg);
+        for (int i = 1; i < runs; i++)
+        {
+            double ms = run(arg);
+            if (ms < best)
+                best = ms;
+        }
+        return best;
+    }
+
+    inline void title(const std::string& name)
+    {
+        std::cout << std::endl << "== " << name << " ==" << std::endl;
+    }
+
+    inline void report(const std::string& name, double value, const std::string& unit = "ms")
+    {
+        std::cout << "  " << std::left << std::setw(44) << name
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(2) << value << " " << unit << std::endl;
+    }
+
+    // 현재 프로세스의 RSS(KB). /proc이 없는 환경에서는 0
+    inline long rss_kb()
+    {
+        long pages = 0;
+        long resident = 0;
+        FILE* statm = fopen("/proc/self/statm", "r");
+        if (statm == NULL)
+            return 0;
+        if (fscanf(statm, "%ld %ld", &pages, &resident) != 2)
+            resident = 0;
+        fclose(statm);
+        return resident * (sysconf(_SC_PAGESIZE) / 1024);
+    }
+
+    // 지금까지 RSS가 가장 컸을 때(KB, /proc/self/status의 VmHWM). fork한 자식은 fork 시점의 RSS부터 센다.
+    inline long peak_rss_kb()
+    {
+        char line[128];
+        long peak = 0;
+        FILE* status = fopen("/proc/self/status", "r");
+        if (status == NULL)
+            return 0;
+        while (fgets(line, sizeof(line), status) != NULL)
+            if (sscanf(line, "VmHWM: %ld", &peak) == 1)
+                break;
+        fclose(status);
+        return peak;
+    }
+}
+
+#endif
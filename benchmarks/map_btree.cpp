@@ -0,0 +1,99 @@
+#include <cstdlib>
+#include "map.hpp"
+#include "btree_map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+// ft::map(rb_tree)과 ft::btree_map의 insert / find / 순회 비용.
+// 키 수가 캐시보다 훨씬 커질수록 차이가 벌어진다. (인자로 키 수를 준다. 예: map_btree 20000000)
+
+template <typename Map>
+double insert_keys(const ft::vector<int>& keys)
+{
+    bench::timer t;
+    Map m;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert(typename Map::value_type(*it, *it));
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+double insert_sorted(const ft::vector<int>& keys)
+{
+    bench::timer t;
+    Map m;
+    for (int i = 0; i < static_cast<int>(keys.size()); i++)
+        m.insert(m.end(), typename Map::value_type(i, i));
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+struct lookup_args
+{
+    const Map*              map;
+    const ft::vector<int>*  probes;
+};
+
+template <typename Map>
+double find_keys(const lookup_args<Map>& args)
+{
+    bench::timer t;
+    long sum = 0;
+    for (ft::vector<int>::const_iterator it = args.probes->begin(); it != args.probes->end(); ++it)
+    {
+        typename Map::const_iterator found = args.map->find(*it);
+        if (found != args.map->end())
+            sum += found->second;
+    }
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+double full_scan(const lookup_args<Map>& args)
+{
+    bench::timer t;
+    long sum = 0;
+    for (int pass = 0; pass < 5; pass++)
+        for (typename Map::const_iterator it = args.map->begin(); it != args.map->end(); ++it)
+            sum += it->second;
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+void run(const char* name, const ft::vector<int>& keys, const ft::vector<int>& probes)
+{
+    Map m;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert(typename Map::value_type(*it, *it));
+    lookup_args<Map> args;
+    args.map = &m;
+    args.probes = &probes;
+
+    bench::title(name);
+    bench::report("insert(value), random keys", bench::best_of(insert_keys<Map>, keys));
+    bench::report("insert(end(), value), sorted keys", bench::best_of(insert_sorted<Map>, keys));
+    bench::report("find, random keys (half present)", bench::best_of(find_keys<Map>, args));
+    bench::report("full scan x5", bench::best_of(full_scan<Map>, args));
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+    ft::vector<int> keys;
+    ft::vector<int> probes;
+
+    srand(42);
+    for (int i = 0; i < count; i++)
+    {
+        keys.push_back(rand());
+        probes.push_back((i % 2) ? keys[rand() % (i + 1)] : rand());
+    }
+
+    run<ft::map<int, int> >("ft::map", keys, probes);
+    run<ft::btree_map<int, int> >("ft::btree_map", keys, probes);
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include <cstdlib>
+#include <map>
+#include <sstream>
+#include "map.hpp"
+#include "bench.hpp"
+
+// main.cpp의 ft::map<int, int> copy = map_int; 처럼 큰 map을 통째로 복사하는 비용을 크기별로 잰다.
+// ft::map은 모양과 색을 그대로 복제하고, 원소가 is_parallel_copyable로 opt-in 했으면
+// FT_RB_TREE_PARALLEL_COPY_THRESHOLD 이상일 때 subtree를 worker thread에서 복제한다. 여기서는 pair<const int, int>가 opt-in 한다.
+// serial_allocator는 std::allocator와 같지만 allocator_is_thread_safe가 false라서 항상 한 thread로 복사한다.
+// 병렬 복사의 이득은 CPU 수에 따라 다르다. (CPU가 하나면 두 줄이 같다)
+
+template <typename T>
+struct serial_allocator : public std::allocator<T>
+{
+    template <typename U>
+    struct rebind { typedef serial_allocator<U> other; };
+
+    serial_allocator() {}
+    serial_allocator(const serial_allocator& alloc): std::allocator<T>(alloc) {}
+    template <typename U>
+    serial_allocator(const serial_allocator<U>&) {}
+};
+
+namespace ft
+{
+    template <>
+    struct is_parallel_copyable<ft::pair<const int, int> > : public true_type {};
+}
+
+typedef ft::map<int, int>                                                                       parallel_map;
+typedef ft::map<int, int, std::less<int>, serial_allocator<ft::pair<const int, int> > >         serial_map;
+typedef std::map<int, int>                                                                      std_map;
+
+template <typename Map>
+double copy_map(const Map& m)
+{
+    bench::timer t;
+    Map copy(m);
+    bench::sink = copy.size();
+    double ms = t.elapsed_ms();
+    return ms;
+}
+
+template <typename Map, typename Pair>
+void fill(Map& m, int count)
+{
+    srand(42);
+    for (int i = 0; i < count; i++)
+        m.insert(Pair(rand(), i));
+}
+
+int main(int argc, char** argv)
+{
+    int max_count = (argc > 1) ? atoi(argv[1]) : 4000000;
+
+    std::cout << "CPUs: " << sysconf(_SC_NPROCESSORS_ONLN)
+              << ", parallel copy from " << FT_RB_TREE_PARALLEL_COPY_THRESHOLD << " nodes" << std::endl;
+    for (int count = 10000; count <= max_count; count *= 10)
+    {
+        std::ostringstream name;
+        name << "copy map<int, int>, " << count << " random keys";
+        bench::title(name.str());
+        {
+            parallel_map m;
+            fill<parallel_map, ft::pair<int, int> >(m, count);
+            bench::report("ft::map", bench::best_of(copy_map<parallel_map>, m));
+        }
+        {
+            serial_map m;
+            fill<serial_map, ft::pair<int, int> >(m, count);
+            bench::report("ft::map, one thread", bench::best_of(copy_map<serial_map>, m));
+        }
+        {
+            std_map m;
+            fill<std_map, std::pair<int, int> >(m, count);
+            bench::report("std::map", bench::best_of(copy_map<std_map>, m));
+        }
+        if (count < max_count && count * 10 > max_count)
+            count = max_count / 10;
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <cstdlib>
+#include <map>
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+// map.erase(first, last)로 앞쪽(오래된 timestamp 만료) / 뒤쪽 / 가운데를 절반씩 지우는 비용.
+// ft::map은 트리를 잘라 가운데를 떼어 내고(split/join) 떼어 낸 노드는 균형 없이 해제한다.
+// 비교 대상은 erase(it++)를 하나씩 부르는 예전 방법과 std::map의 range erase.
+// erase_if는 남는 노드로 트리를 한 번에 다시 세운다. (하나씩 erase하는 loop와 비교)
+
+struct Args
+{
+    int     count;
+    int     from;   // [from, to) 비율(%)의 key를 지운다
+    int     to;
+};
+
+template <typename Map>
+void fill(Map& m, int count)
+{
+    for (int i = 0; i < count; i++)
+        m.insert(typename Map::value_type(i, i));
+}
+
+template <typename Map>
+double erase_range(const Args& args)
+{
+    Map m;
+    fill(m, args.count);
+    bench::timer t;
+    m.erase(m.lower_bound(args.count / 100 * args.from), m.lower_bound(args.count / 100 * args.to));
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+double erase_one_by_one(const Args& args)
+{
+    Map m;
+    fill(m, args.count);
+    bench::timer t;
+    typename Map::iterator first = m.lower_bound(args.count / 100 * args.from);
+    typename Map::iterator last = m.lower_bound(args.count / 100 * args.to);
+    while (first != last)
+        m.erase(first++);
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+struct is_odd
+{
+    template <typename Pair>
+    bool operator()(const Pair& p) const { return p.first % 2 != 0; }
+};
+
+double erase_if_odd(const Args& args)
+{
+    ft::map<int, int> m;
+    fill(m, args.count);
+    bench::timer t;
+    m.erase_if(is_odd());
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+double erase_odd_loop(const Args& args)
+{
+    Map m;
+    fill(m, args.count);
+    bench::timer t;
+    for (typename Map::iterator it = m.begin(); it != m.end();)
+    {
+        if (it->first % 2 != 0)
+            m.erase(it++);
+        else
+            ++it;
+    }
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+void run(const char* name, int count, int from, int to)
+{
+    Args args = { count, from, to };
+    bench::title(name);
+    bench::report("ft::map erase(first, last)", bench::best_of(erase_range<ft::map<int, int> >, args));
+    bench::report("ft::map erase(it++) loop", bench::best_of(erase_one_by_one<ft::map<int, int> >, args));
+    bench::report("std::map erase(first, last)", bench::best_of(erase_range<std::map<int, int> >, args));
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+
+    run("erase prefix (0% - 50%)", count, 0, 50);
+    run("erase suffix (50% - 100%)", count, 50, 100);
+    run("erase middle (25% - 75%)", count, 25, 75);
+
+    Args args = { count, 0, 0 };
+    bench::title("erase every odd key");
+    bench::report("ft::map erase_if", bench::best_of(erase_if_odd, args));
+    bench::report("ft::map erase(it++) loop", bench::best_of(erase_odd_loop<ft::map<int, int> >, args));
+    bench::report("std::map erase(it++) loop", bench::best_of(erase_odd_loop<std::map<int, int> >, args));
+    return 0;
+}
@@ -0,0 +1,157 @@
+#include <cstdlib>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "map.hpp"
+#include "flat_map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+// 한 번 만들고 계속 찾기만 하는 표(lookup table)를 ft::map과 ft::flat_map으로 비교한다.
+// 같은 key들로 만들고, 원소당 메모리와 find 한 번의 시간을 잰다.
+// RSS는 앞선 측정이 남긴 heap의 영향을 받지 않도록 map마다 fork한 자식 프로세스에서 잰다.
+
+typedef ft::map<int, int>       tree_map;
+typedef ft::flat_map<int, int>  flat_map;
+
+struct lookup_args
+{
+    const ft::vector<int>*  keys;
+    const ft::vector<int>*  probes;
+};
+
+// 정렬되지 않은 key를 하나씩 넣는다.
+template <typename Map>
+void build_insert(Map& m, const ft::vector<int>& keys)
+{
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert(ft::make_pair(*it, *it));
+}
+
+// flat_map은 쌓아 두었다가 한 번에 정렬한다.
+void build_deferred(flat_map& m, const ft::vector<int>& keys)
+{
+    m.reserve(keys.size());
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert_deferred(ft::make_pair(*it, *it));
+    m.commit();
+}
+
+template <typename Map>
+double find_all(const Map& m, const ft::vector<int>& probes)
+{
+    bench::timer t;
+    long sum = 0;
+    for (ft::vector<int>::const_iterator it = probes.begin(); it != probes.end(); ++it)
+    {
+        typename Map::const_iterator found = m.find(*it);
+        if (found != m.end())
+            sum += found->second;
+    }
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+double scan(const Map& m)
+{
+    bench::timer t;
+    long sum = 0;
+    for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->second;
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+void report_lookup(const Map& m, const ft::vector<int>& probes)
+{
+    double ms = find_all(m, probes);
+    for (int i = 1; i < 3; i++)
+    {
+        double again = find_all(m, probes);
+        if (again < ms)
+            ms = again;
+    }
+    bench::report("find, random keys", ms);
+    bench::report("find latency", ms * 1000000.0 / probes.size(), "ns");
+    bench::report("in-order scan", scan(m));
+}
+
+void measure_tree(const lookup_args& args)
+{
+    bench::title("ft::map<int, int>");
+    long rss_before = bench::rss_kb();
+    bench::timer t;
+    tree_map m;
+    build_insert(m, *args.keys);
+    bench::report("insert, random keys", t.elapsed_ms());
+    bench::report("RSS / element", (bench::rss_kb() - rss_before) * 1024.0 / m.size(), "bytes");
+    bench::report("node size / element", sizeof(ft::rb_tree_node<tree_map::value_type>), "bytes");
+    report_lookup(m, *args.probes);
+}
+
+void measure_flat(const lookup_args& args)
+{
+    bench::title("ft::flat_map<int, int>");
+    long rss_before = bench::rss_kb();
+    bench::timer t;
+    flat_map m;
+    build_deferred(m, *args.keys);
+    bench::report("insert_deferred + commit, random keys", t.elapsed_ms());
+    bench::report("RSS / element", (bench::rss_kb() - rss_before) * 1024.0 / m.size(), "bytes");
+    bench::report("capacity * sizeof / element", m.capacity() * sizeof(flat_map::value_type) / static_cast<double>(m.size()), "bytes");
+    report_lookup(m, *args.probes);
+
+    // 이미 정렬된 입력은 정렬도 비교도 하지 않고 vector를 그대로 넘겨받는다.
+    flat_map::container_type sorted(m.begin(), m.end());
+    t.reset();
+    flat_map adopted(ft::sorted_unique, sorted);
+    bench::report("construct from sorted vector (sorted_unique)", t.elapsed_ms());
+    bench::sink = adopted.size();
+
+    // 비교용: 하나씩 insert하면 매번 뒤쪽을 밀어야 한다. 양이 많으면 오래 걸리므로 일부만 넣는다.
+    ft::vector<int> part(args.keys->begin(), args.keys->begin() + args.keys->size() / 20);
+    t.reset();
+    flat_map one_by_one;
+    build_insert(one_by_one, part);
+    bench::report("insert one by one, 1/20 of the keys", t.elapsed_ms());
+}
+
+void run_in_child(void (*measure)(const lookup_args&), const lookup_args& args)
+{
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        measure(args);
+        std::cout.flush();
+        _exit(0);
+    }
+    if (pid > 0)
+        waitpid(pid, NULL, 0);
+    else
+        measure(args);
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int queries = 1000000;
+    ft::vector<int> keys;
+    ft::vector<int> probes;
+
+    srand(42);
+    for (int i = 0; i < count; i++)
+        keys.push_back(rand());
+    // 절반은 있는 key, 절반은 (거의) 없는 key
+    for (int i = 0; i < queries; i++)
+        probes.push_back((i % 2) ? keys[rand() % count] : rand());
+
+    lookup_args args;
+    args.keys = &keys;
+    args.probes = &probes;
+
+    run_in_child(measure_tree, args);
+    run_in_child(measure_flat, args);
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <cstdlib>
+#include <tr1/unordered_map>
+#include "map.hpp"
+#include "unordered_map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+// main.cpp의 map_int 검사와 같은 패턴(무작위 key insert 후 map_int[access])을
+// ft::map, ft::unordered_map, std::unordered_map으로 비교한다.
+// C++98로 빌드하므로 std::unordered_map 대신 같은 구현인 std::tr1::unordered_map을 쓴다.
+
+typedef ft::map<int, int>                   tree_map;
+typedef ft::unordered_map<int, int>         hash_map;
+typedef std::tr1::unordered_map<int, int>   std_hash_map;
+
+template <typename Map, typename Pair>
+double insert_random(const ft::vector<int>& keys)
+{
+    bench::timer t;
+    Map m;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert(Pair(*it, *it));
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+// main.cpp: sum += map_int[access] (대부분 없는 key라서 insert가 섞인다)
+template <typename Map, typename Pair>
+double subscript_random(const ft::vector<int>& keys)
+{
+    Map m;
+    for (ft::vector<int>::size_type i = 0; i < keys.size(); i += 2)
+        m.insert(Pair(keys[i], keys[i]));
+    bench::timer t;
+    long sum = 0;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        sum += m[*it];
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+// 반은 있는 key, 반은 없는 key
+template <typename Map, typename Pair>
+double find_hit_miss(const ft::vector<int>& keys)
+{
+    Map m;
+    for (ft::vector<int>::size_type i = 0; i < keys.size(); i += 2)
+        m.insert(Pair(keys[i], keys[i]));
+    bench::timer t;
+    long found = 0;
+    for (int pass = 0; pass < 3; pass++)
+        for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+            found += (m.find(*it) != m.end());
+    bench::sink = found;
+    return t.elapsed_ms();
+}
+
+template <typename Map, typename Pair>
+double erase_half(const ft::vector<int>& keys)
+{
+    Map m;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert(Pair(*it, *it));
+    bench::timer t;
+    for (ft::vector<int>::size_type i = 0; i < keys.size(); i += 2)
+        m.erase(keys[i]);
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+template <typename Map, typename Pair>
+double scan(const ft::vector<int>& keys)
+{
+    Map m;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert(Pair(*it, *it));
+    bench::timer t;
+    long sum = 0;
+    for (int pass = 0; pass < 5; pass++)
+        for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+            sum += it->second;
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+template <typename Map, typename Pair>
+void run(const char* name, const ft::vector<int>& keys)
+{
+    bench::title(name);
+    bench::report("insert, random keys", bench::best_of(insert_random<Map, Pair>, keys));
+    bench::report("operator[], random keys", bench::best_of(subscript_random<Map, Pair>, keys));
+    bench::report("find x3, half hit / half miss", bench::best_of(find_hit_miss<Map, Pair>, keys));
+    bench::report("erase half", bench::best_of(erase_half<Map, Pair>, keys));
+    bench::report("iterate x5", bench::best_of(scan<Map, Pair>, keys));
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+    ft::vector<int> keys;
+
+    srand(42);
+    for (int i = 0; i < count; i++)
+        keys.push_back(rand());
+
+    run<tree_map, ft::pair<int, int> >("ft::map", keys);
+    run<hash_map, ft::pair<int, int> >("ft::unordered_map", keys);
+    run<std_hash_map, std::pair<int, int> >("std::tr1::unordered_map", keys);
+    return 0;
+}
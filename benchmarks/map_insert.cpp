@@ -0,0 +1,73 @@
+#include <cstdlib>
+#include <map>
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+// map<int, int>::insert(value) 비용을 무작위 키와 정렬된 키 스트림으로 측정한다.
+// main.cpp처럼 (rand(), rand()) 쌍을 넣는 경우가 무작위 스트림이다.
+
+template <typename Map, typename Pair>
+double insert_keys(const ft::vector<int>& keys)
+{
+    bench::timer t;
+    Map m;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert(Pair(*it, *it));
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+template <typename Map, typename Pair>
+double insert_end_hint(const ft::vector<int>& keys)
+{
+    bench::timer t;
+    Map m;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert(m.end(), Pair(*it, *it));
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+template <typename Map, typename Pair>
+double insert_range(const ft::vector<Pair>& pairs)
+{
+    bench::timer t;
+    Map m;
+    m.insert(pairs.begin(), pairs.end());
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+    ft::vector<int> random_keys;
+    ft::vector<int> sorted_keys;
+
+    srand(42);
+    for (int i = 0; i < count; i++)
+    {
+        random_keys.push_back(rand());
+        sorted_keys.push_back(i);
+    }
+
+    bench::title("insert(value), random keys");
+    bench::report("ft::map", bench::best_of(insert_keys<ft::map<int, int>, ft::pair<int, int> >, random_keys));
+    bench::report("std::map", bench::best_of(insert_keys<std::map<int, int>, std::pair<int, int> >, random_keys));
+
+    bench::title("insert(value), sorted keys");
+    bench::report("ft::map", bench::best_of(insert_keys<ft::map<int, int>, ft::pair<int, int> >, sorted_keys));
+    bench::report("std::map", bench::best_of(insert_keys<std::map<int, int>, std::pair<int, int> >, sorted_keys));
+
+    bench::title("insert(end(), value), sorted keys");
+    bench::report("ft::map", bench::best_of(insert_end_hint<ft::map<int, int>, ft::pair<int, int> >, sorted_keys));
+    bench::report("std::map", bench::best_of(insert_end_hint<std::map<int, int>, std::pair<int, int> >, sorted_keys));
+
+    ft::vector<ft::pair<int, int> > sorted_pairs;
+    for (int i = 0; i < count; i++)
+        sorted_pairs.push_back(ft::make_pair(i, i));
+    bench::title("insert(first, last), sorted pairs");
+    bench::report("ft::map", bench::best_of(insert_range<ft::map<int, int>, ft::pair<int, int> >, sorted_pairs));
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <cstdlib>
+#include <cstdio>
+#include <map>
+#include <string>
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+// key만으로 검색하는 비용. 예전에는 find/count/operator[]마다 mapped_type을 만들고 지웠기 때문에
+// mapped_type이 무거울수록 검색이 느려졌다.
+
+struct Record
+{
+    std::string name;
+    int         fields[32];
+
+    Record(): name(64, 'r') { fields[0] = 0; }
+};
+
+template <typename Map>
+double find_ints(const ft::vector<int>& keys)
+{
+    Map m;
+    for (ft::vector<int>::size_type i = 0; i < keys.size(); i += 2)
+        m[keys[i]];
+    bench::timer t;
+    long found = 0;
+    for (int pass = 0; pass < 5; pass++)
+        for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+            found += m.count(*it);
+    bench::sink = found;
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+double subscript_ints(const ft::vector<int>& keys)
+{
+    Map m;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m[*it];
+    bench::timer t;
+    long sum = 0;
+    for (int pass = 0; pass < 5; pass++)
+        for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+            sum += m[*it].fields[0];
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+// const char*로 검색: transparent comparator라면 std::string을 만들지 않는다.
+template <typename Map>
+double find_c_strings(const ft::vector<const char*>& names)
+{
+    Map m;
+    for (ft::vector<const char*>::size_type i = 0; i < names.size(); i++)
+        m[names[i]] = i;
+    bench::timer t;
+    long found = 0;
+    for (int pass = 0; pass < 5; pass++)
+        for (ft::vector<const char*>::const_iterator it = names.begin(); it != names.end(); ++it)
+            found += (m.find(*it) != m.end());
+    bench::sink = found;
+    return t.elapsed_ms();
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 200000;
+    ft::vector<int> keys;
+    ft::vector<std::string> storage;
+    ft::vector<const char*> names;
+
+    srand(42);
+    for (int i = 0; i < count; i++)
+    {
+        char buffer[64];
+        keys.push_back(rand());
+        snprintf(buffer, sizeof(buffer), "customer/%08d/profile/long-enough-to-skip-sso", rand());
+        storage.push_back(buffer);
+    }
+    for (ft::vector<std::string>::size_type i = 0; i < storage.size(); i++)
+        names.push_back(storage[i].c_str());
+
+    bench::title("count(key) x5, map<int, Record>, half hits");
+    bench::report("ft::map", bench::best_of(find_ints<ft::map<int, Record> >, keys));
+    bench::report("std::map", bench::best_of(find_ints<std::map<int, Record> >, keys));
+
+    bench::title("operator[] on existing keys x5, map<int, Record>");
+    bench::report("ft::map", bench::best_of(subscript_ints<ft::map<int, Record> >, keys));
+    bench::report("std::map", bench::best_of(subscript_ints<std::map<int, Record> >, keys));
+
+    bench::title("find(const char*) x5, map<std::string, int>");
+    bench::report("ft::map", bench::best_of(find_c_strings<ft::map<std::string, int> >, names));
+    bench::report("ft::map, ft::less<>", bench::best_of(find_c_strings<ft::map<std::string, int, ft::less<> > >, names));
+    bench::report("std::map", bench::best_of(find_c_strings<std::map<std::string, int> >, names));
+    return 0;
+}
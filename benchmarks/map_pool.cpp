@@ -0,0 +1,97 @@
+#include <cstdlib>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "map.hpp"
+#include "vector.hpp"
+#include "pool_allocator.hpp"
+#include "bench.hpp"
+
+// map<int, int>의 노드 할당을 std::allocator와 ft::pool_allocator로 비교한다.
+// RSS는 프로세스 안에서 앞선 측정이 남긴 heap의 영향을 받으므로 allocator마다 fork한 자식 프로세스에서 잰다.
+
+typedef ft::map<int, int>                                                                   std_map;
+typedef ft::map<int, int, std::less<int>, ft::pool_allocator<ft::pair<const int, int> > >   pool_map;
+
+// 트리 작업 없이 allocator만: 노드 크기 객체를 전부 할당한 뒤 전부 돌려준다.
+template <typename Map>
+double allocate_only(ft::vector<int>::size_type count)
+{
+    typedef typename Map::allocator_type::template rebind<ft::rb_tree_node<typename Map::value_type> >::other   node_allocator;
+    node_allocator alloc;
+    ft::vector<typename node_allocator::pointer> nodes(count);
+
+    bench::timer t;
+    for (ft::vector<int>::size_type i = 0; i < count; i++)
+        nodes[i] = alloc.allocate(1);
+    for (ft::vector<int>::size_type i = 0; i < count; i++)
+        alloc.deallocate(nodes[i], 1);
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+void measure(const char* name, const ft::vector<int>& keys)
+{
+    bench::title(name);
+    long rss_before = bench::rss_kb();
+    bench::timer t;
+    {
+        Map m;
+        for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+            m.insert(ft::make_pair(*it, *it));
+        double build_ms = t.elapsed_ms();
+        bench::report("insert, random keys", build_ms);
+        bench::report("RSS growth", (bench::rss_kb() - rss_before) / 1024.0, "MB");
+
+        t.reset();
+        long sum = 0;
+        for (int pass = 0; pass < 5; pass++)
+            for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+                sum += it->second;
+        bench::sink = sum;
+        bench::report("in-order traversal x5", t.elapsed_ms());
+
+        t.reset();
+        for (ft::vector<int>::size_type i = 0; i < keys.size(); i += 2)
+            m.erase(keys[i]);
+        for (ft::vector<int>::size_type i = 0; i < keys.size(); i += 2)
+            m.insert(ft::make_pair(keys[i], i));
+        bench::report("erase half + reinsert", t.elapsed_ms());
+        t.reset();
+    }
+    bench::report("destruction", t.elapsed_ms());
+
+    double alloc_ms = allocate_only<Map>(keys.size());
+    bench::report("allocate(1) + deallocate", alloc_ms);
+    bench::report("allocations / sec", keys.size() / alloc_ms / 1000.0, "M/s");
+}
+
+template <typename Map>
+void run_in_child(const char* name, const ft::vector<int>& keys)
+{
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        measure<Map>(name, keys);
+        std::cout.flush();
+        _exit(0);
+    }
+    if (pid > 0)
+        waitpid(pid, NULL, 0);
+    else
+        measure<Map>(name, keys);
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 2000000;
+    ft::vector<int> keys;
+
+    srand(42);
+    for (int i = 0; i < count; i++)
+        keys.push_back(rand());
+
+    run_in_child<std_map>("ft::map, std::allocator", keys);
+    run_in_child<pool_map>("ft::map, ft::pool_allocator", keys);
+    return 0;
+}
@@ -0,0 +1,142 @@
+#define FT_RB_TREE_ORDER_STATISTICS
+#include <cstdlib>
+#include <map>
+#include "map.hpp"
+#include "vector.hpp"
+#include "algorithm.hpp"
+#include "bench.hpp"
+
+// FT_RB_TREE_ORDER_STATISTICS를 켠 map의 select / rank / count_range를
+// 기존 방법(begin()부터 걸어가며 세기, ft::difference)과 비교한다.
+// 노드마다 _count를 유지하는 비용은 insert / erase 시간으로 std::map과 비교한다.
+// (켜지 않은 ft::map의 insert 시간은 map_insert에서 볼 수 있다.)
+
+typedef ft::map<int, int>   rank_map;
+
+struct rank_args
+{
+    const rank_map*         map;
+    const ft::vector<int>*  probes;
+};
+
+double select_walk(const rank_args& args)
+{
+    bench::timer t;
+    long sum = 0;
+    for (ft::vector<int>::const_iterator p = args.probes->begin(); p != args.probes->end(); ++p)
+    {
+        rank_map::const_iterator it = args.map->begin();
+        for (int k = *p; k > 0; k--)
+            ++it;
+        sum += it->first;
+    }
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+double select_tree(const rank_args& args)
+{
+    bench::timer t;
+    long sum = 0;
+    for (ft::vector<int>::const_iterator p = args.probes->begin(); p != args.probes->end(); ++p)
+        sum += args.map->select(*p)->first;
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+double rank_difference(const rank_args& args)
+{
+    bench::timer t;
+    long sum = 0;
+    for (ft::vector<int>::const_iterator p = args.probes->begin(); p != args.probes->end(); ++p)
+        sum += ft::difference(args.map->begin(), args.map->lower_bound(*p));
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+double rank_tree(const rank_args& args)
+{
+    bench::timer t;
+    long sum = 0;
+    for (ft::vector<int>::const_iterator p = args.probes->begin(); p != args.probes->end(); ++p)
+        sum += args.map->rank(*p);
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+// [key, key + 폭의 절반) 안의 원소 수
+double count_range_difference(const rank_args& args)
+{
+    bench::timer t;
+    long sum = 0;
+    int width = static_cast<int>(args.map->size());
+    for (ft::vector<int>::const_iterator p = args.probes->begin(); p != args.probes->end(); ++p)
+        sum += ft::difference(args.map->lower_bound(*p), args.map->lower_bound(*p + width / 2));
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+double count_range_tree(const rank_args& args)
+{
+    bench::timer t;
+    long sum = 0;
+    int width = static_cast<int>(args.map->size());
+    for (ft::vector<int>::const_iterator p = args.probes->begin(); p != args.probes->end(); ++p)
+        sum += args.map->count_range(*p, *p + width / 2);
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+template <typename Map, typename Pair>
+double insert_erase(const ft::vector<int>& keys)
+{
+    bench::timer t;
+    Map m;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert(Pair(*it, *it));
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); it += 2)
+        m.erase(*it);
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 100000;
+    int queries = 2000;
+    ft::vector<int> keys;
+    ft::vector<int> probes;
+    rank_map m;
+
+    srand(42);
+    for (int i = 0; i < count; i++)
+    {
+        keys.push_back(rand());
+        m.insert(ft::make_pair(i, i));
+    }
+    if (count % 2)
+        keys.push_back(rand());
+    for (int i = 0; i < queries; i++)
+        probes.push_back(rand() % count);
+
+    rank_args args;
+    args.map = &m;
+    args.probes = &probes;
+
+    bench::title("select(k), 2000 queries");
+    bench::report("walk k steps from begin()", bench::best_of(select_walk, args));
+    bench::report("ft::map::select", bench::best_of(select_tree, args));
+
+    bench::title("rank(key), 2000 queries");
+    bench::report("ft::difference(begin(), lower_bound)", bench::best_of(rank_difference, args));
+    bench::report("ft::map::rank", bench::best_of(rank_tree, args));
+
+    bench::title("count_range(lo, hi), 2000 queries");
+    bench::report("ft::difference(lower_bound, lower_bound)", bench::best_of(count_range_difference, args));
+    bench::report("ft::map::count_range", bench::best_of(count_range_tree, args));
+
+    bench::title("insert + erase half, random keys");
+    bench::report("ft::map (order statistics)", bench::best_of(insert_erase<rank_map, ft::pair<int, int> >, keys));
+    bench::report("std::map", bench::best_of(insert_erase<std::map<int, int>, std::pair<int, int> >, keys));
+    return 0;
+}
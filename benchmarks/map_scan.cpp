@@ -0,0 +1,139 @@
+#include <cstdlib>
+#include <map>
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+// iterator ++/-- 비용. make bench는 이 파일을 두 번 빌드한다.
+//   map_scan          : 부모를 따라 올라가는 기본 순회
+//   map_scan_threaded : -D FT_RB_TREE_THREADED, 노드의 _next/_prev를 따라가는 순회
+// 키를 무작위 순서로 넣어서 in-order로 이웃한 노드가 메모리에서는 흩어져 있게 한다.
+
+#ifdef FT_RB_TREE_THREADED
+# define FT_LABEL "ft::map (threaded)"
+#else
+# define FT_LABEL "ft::map (parent walk)"
+#endif
+
+struct scan_args
+{
+    const ft::vector<int>*  probes;
+    int                     width;
+};
+
+template <typename Map>
+double full_scan(const Map& m)
+{
+    bench::timer t;
+    long sum = 0;
+    for (int pass = 0; pass < 10; pass++)
+        for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+            sum += it->second;
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+double reverse_scan(const Map& m)
+{
+    bench::timer t;
+    long sum = 0;
+    for (int pass = 0; pass < 10; pass++)
+    {
+        typename Map::const_iterator it = m.end();
+        while (it != m.begin())
+            sum += (--it)->second;
+    }
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+static void consume(long value) { bench::sink += value; }
+
+// 컴파일러가 볼 수 없는 함수 호출. 호출 사이에 트리가 바뀌었을 수도 있으므로 ->를 다시 계산하게 만든다.
+static void (* volatile opaque_consume)(long) = consume;
+
+// reverse_iterator로 뒤에서부터 읽고 ->first, ->second를 둘 다 넘긴다. ("최근 N개" 조회)
+template <typename Map>
+double reverse_iterator_scan(const Map& m, int passes)
+{
+    bench::timer t;
+    for (int pass = 0; pass < passes; pass++)
+        for (typename Map::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+        {
+            opaque_consume(it->first);
+            opaque_consume(it->second);
+        }
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+double range_scan(const Map& m, const scan_args& args)
+{
+    bench::timer t;
+    long sum = 0;
+    for (ft::vector<int>::const_iterator key = args.probes->begin(); key != args.probes->end(); ++key)
+    {
+        typename Map::const_iterator it = m.lower_bound(*key);
+        for (int i = 0; i < args.width && it != m.end(); i++, ++it)
+            sum += it->second;
+    }
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+void run(const char* name, const ft::vector<int>& keys, const scan_args& args)
+{
+    Map m;
+    for (ft::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+        m.insert(typename Map::value_type(*it, *it));
+
+    double best[4] = { full_scan(m), reverse_scan(m), reverse_iterator_scan(m, 10), range_scan(m, args) };
+    for (int i = 1; i < 3; i++)
+    {
+        double ms[4] = { full_scan(m), reverse_scan(m), reverse_iterator_scan(m, 10), range_scan(m, args) };
+        for (int j = 0; j < 4; j++)
+            if (ms[j] < best[j])
+                best[j] = ms[j];
+    }
+    bench::title(name);
+    bench::report("full scan x10, ++", best[0]);
+    bench::report("full scan x10, --", best[1]);
+    bench::report("full scan x10, rbegin() -> rend()", best[2]);
+    bench::report("lower_bound + 64 x ++", best[3]);
+}
+
+// 캐시에 다 들어가는 작은 map에서는 메모리 대기 대신 노드를 걷는 비용이 드러난다.
+template <typename Map>
+double small_reverse_scan(const ft::vector<int>& keys)
+{
+    Map m;
+    for (ft::vector<int>::size_type i = 0; i < 10000 && i < keys.size(); i++)
+        m.insert(typename Map::value_type(keys[i], keys[i]));
+    return reverse_iterator_scan(m, 1000);
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+    ft::vector<int> keys;
+    ft::vector<int> probes;
+
+    srand(42);
+    for (int i = 0; i < count; i++)
+        keys.push_back(rand());
+    for (int i = 0; i < 100000; i++)
+        probes.push_back(rand());
+
+    scan_args args;
+    args.probes = &probes;
+    args.width = 64;
+    run<ft::map<int, int> >(FT_LABEL, keys, args);
+    run<std::map<int, int> >("std::map", keys, args);
+
+    bench::title("10k entries x1000, rbegin() -> rend()");
+    bench::report(FT_LABEL, bench::best_of(small_reverse_scan<ft::map<int, int> >, keys));
+    bench::report("std::map", bench::best_of(small_reverse_scan<std::map<int, int> >, keys));
+    return 0;
+}
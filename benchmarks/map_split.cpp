@@ -0,0 +1,117 @@
+#include <cstdlib>
+#include <map>
+#include "map.hpp"
+#include "bench.hpp"
+
+// key 범위로 나눈 shard를 다시 나누고 합치는 비용. map 하나를 가운데 key에서 둘로 나눈 뒤 다시 하나로 합친다.
+// ft::map은 split/join으로 노드를 그대로 넘기고, 비교 대상은 반쪽을 다른 map에 insert한 뒤 range erase하는 방법.
+// split + join 자체는 O(log n)이다. FT_RB_TREE_ORDER_STATISTICS가 아니면 잘린 조각의 크기는 처음 size()를 부를 때 세므로
+// 그 비용은 size()를 부르는 경우에 따로 잰다.
+
+template <typename Map>
+void fill(Map& m, int count)
+{
+    for (int i = 0; i < count; i++)
+        m.insert(m.end(), typename Map::value_type(i, i));
+}
+
+double split_join(const int& count)
+{
+    ft::map<int, int> m;
+    ft::map<int, int> upper;
+    fill(m, count);
+    bench::timer t;
+    m.split(count / 2, upper);
+    m.join(upper);
+    bench::sink = m.begin()->first;
+    return t.elapsed_ms();
+}
+
+double split_join_size(const int& count)
+{
+    ft::map<int, int> m;
+    ft::map<int, int> upper;
+    fill(m, count);
+    bench::timer t;
+    m.split(count / 2, upper);
+    bench::sink = m.size() + upper.size();
+    m.join(upper);
+    bench::sink += m.size();
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+double reinsert(const int& count)
+{
+    Map m;
+    Map upper;
+    fill(m, count);
+    bench::timer t;
+    typename Map::iterator mid = m.lower_bound(count / 2);
+    upper.insert(mid, m.end());
+    m.erase(mid, m.end());
+    bench::sink = m.size() + upper.size();
+    m.insert(upper.begin(), upper.end());
+    upper.clear();
+    bench::sink += m.size();
+    return t.elapsed_ms();
+}
+
+// 가장자리 근처에서 자르면 작은 쪽만 움직이면 되므로 insert + erase도 빨라진다.
+// 잘린 곳이 끝에서 멀어서 크기를 세지 않았으면 join한 map도 처음 size()에서 모두 센다.
+double split_join_edge(const int& count)
+{
+    ft::map<int, int> m;
+    ft::map<int, int> upper;
+    fill(m, count);
+    bench::timer t;
+    m.split(count - count / 100, upper);
+    m.join(upper);
+    bench::sink = m.begin()->first;
+    return t.elapsed_ms();
+}
+
+double split_join_edge_size(const int& count)
+{
+    ft::map<int, int> m;
+    ft::map<int, int> upper;
+    fill(m, count);
+    bench::timer t;
+    m.split(count - count / 100, upper);
+    m.join(upper);
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+template <typename Map>
+double reinsert_edge(const int& count)
+{
+    Map m;
+    Map upper;
+    fill(m, count);
+    bench::timer t;
+    typename Map::iterator cut = m.lower_bound(count - count / 100);
+    upper.insert(cut, m.end());
+    m.erase(cut, m.end());
+    m.insert(upper.begin(), upper.end());
+    upper.clear();
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+
+    bench::title("map<int, int>, split at the middle key and join back");
+    bench::report("ft::map split + join", bench::best_of(split_join, count));
+    bench::report("ft::map split + size() + join + size()", bench::best_of(split_join_size, count));
+    bench::report("ft::map insert + erase", bench::best_of(reinsert<ft::map<int, int> >, count));
+    bench::report("std::map insert + erase", bench::best_of(reinsert<std::map<int, int> >, count));
+    bench::title("map<int, int>, split off the last 1% and join back");
+    bench::report("ft::map split + join", bench::best_of(split_join_edge, count));
+    bench::report("ft::map split + join + size()", bench::best_of(split_join_edge_size, count));
+    bench::report("ft::map insert + erase", bench::best_of(reinsert_edge<ft::map<int, int> >, count));
+    bench::report("std::map insert + erase", bench::best_of(reinsert_edge<std::map<int, int> >, count));
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include <string>
+#include "map.hpp"
+#include "set.hpp"
+#include "bench.hpp"
+
+// rb_tree_node 한 개의 크기. legacy_node는 색을 부모 포인터에 넣기 전의 배치(value, color, 링크 3개)다.
+
+template <typename T>
+struct legacy_node
+{
+    T           value;
+    ft::color   color;
+    void*       parent;
+    void*       left;
+    void*       right;
+};
+
+// 링크 3개 + value를 포인터 크기로 올림한 크기. 색 때문에 늘어나는 byte가 없어야 한다.
+template <typename T>
+struct compact_size
+{
+    static const std::size_t value = 3 * sizeof(void*) + (sizeof(T) + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+};
+
+typedef ft::map<int, int>::value_type            map_int_int;
+typedef ft::map<long, long>::value_type          map_long_long;
+typedef ft::map<int, double>::value_type         map_int_double;
+typedef ft::map<std::string, int>::value_type    map_string_int;
+
+// C++98에는 static_assert가 없으므로 크기가 -1인 배열을 만들게 해서 컴파일 타임에 확인한다.
+#define NODE_SIZE_CHECK(name, T) \
+    typedef char name[(sizeof(ft::rb_tree_node<T >) == compact_size<T >::value) ? 1 : -1]
+
+NODE_SIZE_CHECK(set_int_node_is_compact, int);
+NODE_SIZE_CHECK(set_long_node_is_compact, long);
+NODE_SIZE_CHECK(map_int_int_node_is_compact, map_int_int);
+NODE_SIZE_CHECK(map_long_long_node_is_compact, map_long_long);
+NODE_SIZE_CHECK(map_int_double_node_is_compact, map_int_double);
+NODE_SIZE_CHECK(set_string_node_is_compact, std::string);
+NODE_SIZE_CHECK(map_string_int_node_is_compact, map_string_int);
+
+template <typename T>
+void report_node(const char* name)
+{
+    std::cout << "  " << std::left << std::setw(36) << name
+              << std::right << std::setw(8) << sizeof(legacy_node<T>) << " B"
+              << std::setw(8) << sizeof(ft::rb_tree_node<T>) << " B" << std::endl;
+}
+
+int main()
+{
+    bench::title("bytes per rb_tree_node (before / after)");
+    report_node<int>("set<int>");
+    report_node<long>("set<long>");
+    report_node<map_int_int>("map<int, int>");
+    report_node<map_long_long>("map<long, long>");
+    report_node<map_int_double>("map<int, double>");
+    report_node<std::string>("set<std::string>");
+    report_node<map_string_int>("map<std::string, int>");
+    return 0;
+}
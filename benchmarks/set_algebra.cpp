@@ -0,0 +1,153 @@
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include "set.hpp"
+#include "bench.hpp"
+
+// 두 set의 교집합과 합집합을 만드는 비용. 예전에는 한쪽을 돌며 다른 쪽에 find하는 loop(O(n log m))로 만들었다.
+// ft::set의 merge_*는 크기가 비슷하면 둘을 같이 훑어 남는 노드로 트리를 한 번에 다시 세우고(O(n + m)),
+// 한쪽이 8배 이상 작으면 작은 쪽 원소만 큰 쪽에서 찾는다(O(m log n)). 크기 비에 따른 차이는 crossover 표에 있다.
+// 비교 대상은 std::set_intersection / std::set_union 결과를 std::inserter로 std::set에 넣는 방법.
+// 교집합은 작은 쪽(b)을 결과로 쓴다. 큰 쪽을 결과로 쓰면 빠지는 노드를 모두 해제해야 해서 O(n)을 피할 수 없다.
+
+struct Args
+{
+    int     big;
+    int     small;
+};
+
+// 짝수 key n개와 3의 배수 key m개 (겹치는 key는 6의 배수)
+template <typename Set>
+void fill(Set& a, Set& b, const Args& args)
+{
+    for (int i = 0; i < args.big; i++)
+        a.insert(a.end(), i * 2);
+    int step = 3 * (args.big / args.small);
+    for (int i = 0; i < args.small; i++)
+        b.insert(b.end(), i * step);
+}
+
+double ft_intersection(const Args& args)
+{
+    ft::set<int> a, b;
+    fill(a, b, args);
+    bench::timer t;
+    b.merge_intersection(a);
+    bench::sink = b.size();
+    return t.elapsed_ms();
+}
+
+double ft_find_loop(const Args& args)
+{
+    ft::set<int> a, b, result;
+    fill(a, b, args);
+    bench::timer t;
+    for (ft::set<int>::iterator it = b.begin(); it != b.end(); ++it)
+        if (a.find(*it) != a.end())
+            result.insert(result.end(), *it);
+    bench::sink = result.size();
+    return t.elapsed_ms();
+}
+
+double std_intersection(const Args& args)
+{
+    std::set<int> a, b, result;
+    fill(a, b, args);
+    bench::timer t;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::inserter(result, result.end()));
+    bench::sink = result.size();
+    return t.elapsed_ms();
+}
+
+double ft_union(const Args& args)
+{
+    ft::set<int> a, b;
+    fill(a, b, args);
+    bench::timer t;
+    a.merge_union(b);
+    bench::sink = a.size();
+    return t.elapsed_ms();
+}
+
+double ft_insert_loop(const Args& args)
+{
+    ft::set<int> a, b;
+    fill(a, b, args);
+    bench::timer t;
+    for (ft::set<int>::iterator it = b.begin(); it != b.end(); ++it)
+        a.insert(*it);
+    bench::sink = a.size();
+    return t.elapsed_ms();
+}
+
+double std_union(const Args& args)
+{
+    std::set<int> a, b, result;
+    fill(a, b, args);
+    bench::timer t;
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::inserter(result, result.end()));
+    bench::sink = result.size();
+    return t.elapsed_ms();
+}
+
+void run(const std::string& sizes, int big, int small)
+{
+    Args args = { big, small };
+    bench::title("set<int> intersection, " + sizes);
+    bench::report("ft::set merge_intersection", bench::best_of(ft_intersection, args));
+    bench::report("ft::set find loop", bench::best_of(ft_find_loop, args));
+    bench::report("std::set_intersection + inserter", bench::best_of(std_intersection, args));
+    bench::title("set<int> union, " + sizes);
+    bench::report("ft::set merge_union", bench::best_of(ft_union, args));
+    bench::report("ft::set insert loop", bench::best_of(ft_insert_loop, args));
+    bench::report("std::set_union + inserter", bench::best_of(std_union, args));
+}
+
+// 앞선 측정이 남긴 heap 상태에 따라 노드가 흩어지면 in-order로 훑는 쪽만 크게 느려지므로, 표의 칸마다 새 프로세스에서 잰다.
+void report_in_child(const std::string& name, double (*run)(const Args&), const Args& args)
+{
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        bench::report(name, bench::best_of(run, args));
+        std::cout.flush();
+        _exit(0);
+    }
+    if (pid > 0)
+        waitpid(pid, NULL, 0);
+    else
+        bench::report(name, bench::best_of(run, args));
+}
+
+// 크기 비(n / m)를 늘려 가며 merge_*와 원소마다 find / insert하는 loop를 나란히 잰다.
+// merge_*는 n / m이 8보다 작으면 훑고, 그 이상이면 작은 쪽 원소마다 찾는다.
+void crossover(int big)
+{
+    const int ratios[] = { 1, 4, 16, 64, 256, 1000 };
+    bench::title("crossover by size ratio n / m (n = big set)");
+    for (std::size_t i = 0; i < sizeof(ratios) / sizeof(ratios[0]); i++)
+    {
+        Args args = { big, big / ratios[i] };
+        std::ostringstream ratio;
+        ratio << "n / m = " << ratios[i] << ", ";
+        report_in_child(ratio.str() + "merge_intersection", ft_intersection, args);
+        report_in_child(ratio.str() + "find loop", ft_find_loop, args);
+        report_in_child(ratio.str() + "merge_union", ft_union, args);
+        report_in_child(ratio.str() + "insert loop", ft_insert_loop, args);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+
+    run("same size", count, count);
+    run("1000x smaller", count, count / 1000);
+    crossover(count);
+    return 0;
+}
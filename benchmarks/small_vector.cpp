@@ -0,0 +1,90 @@
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include "vector.hpp"
+#include "small_vector.hpp"
+#include "bench.hpp"
+
+// 원소가 몇 개 안 되는 vector를 많이 만들 때 allocator 호출 횟수와 시간을 비교한다.
+// ft::vector는 push_back마다 capacity 1, 2, 4, 8...로 할당하므로 원소 4개에 할당이 3번이다.
+
+// allocate 횟수만 세는 std::allocator
+template <typename T>
+class counting_allocator : public std::allocator<T>
+{
+    public:
+        typedef typename std::allocator<T>::pointer     pointer;
+        typedef typename std::allocator<T>::size_type   size_type;
+        template <typename U>
+        struct rebind { typedef counting_allocator<U> other; };
+
+        static long allocations;
+
+        counting_allocator() {}
+        counting_allocator(const counting_allocator& other): std::allocator<T>(other) {}
+        template <typename U>
+        counting_allocator(const counting_allocator<U>& other): std::allocator<T>(other) {}
+
+        pointer allocate(size_type n, const void* hint = 0)
+        {
+            allocations++;
+            return std::allocator<T>::allocate(n, hint);
+        }
+};
+
+template <typename T>
+long counting_allocator<T>::allocations = 0;
+
+typedef ft::vector<int, counting_allocator<int> >           counted_vector;
+typedef ft::small_vector<int, 8, counting_allocator<int> >  counted_small_vector;
+
+struct fill_args
+{
+    int size;
+    int repeat;
+};
+
+// 크기 size짜리 vector를 repeat번 만들고 버린다.
+template <typename Vector>
+double fill(const fill_args& args)
+{
+    bench::timer t;
+    long sum = 0;
+    for (int r = 0; r < args.repeat; r++)
+    {
+        Vector v;
+        for (int i = 0; i < args.size; i++)
+            v.push_back(i);
+        sum += v.back();
+    }
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+int main(int argc, char** argv)
+{
+    int repeat = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int sizes[] = {1, 2, 4, 8, 9, 16};
+
+    for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        fill_args args;
+        args.size = sizes[i];
+        args.repeat = 1;
+
+        std::ostringstream name;
+        name << sizes[i] << " x push_back, " << repeat << " vectors";
+        bench::title(name.str());
+        counting_allocator<int>::allocations = 0;
+        fill<counted_vector>(args);
+        bench::report("ft::vector allocations / vector", counting_allocator<int>::allocations, "");
+        counting_allocator<int>::allocations = 0;
+        fill<counted_small_vector>(args);
+        bench::report("ft::small_vector<int, 8> allocations / vector", counting_allocator<int>::allocations, "");
+
+        args.repeat = repeat;
+        bench::report("ft::vector", bench::best_of(fill<counted_vector>, args));
+        bench::report("ft::small_vector<int, 8>", bench::best_of(fill<counted_small_vector>, args));
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <cstdlib>
+#include <deque>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "stack.hpp"
+#include "vector.hpp"
+#include "deque.hpp"
+#include "bench.hpp"
+
+// main.cpp의 stack_deq_buffer처럼 4 KB Buffer를 쌓았다가 모두 꺼내는 비용을
+// ft::vector / ft::deque / std::deque를 container로 쓰는 ft::stack끼리 비교한다.
+// vector는 capacity가 찰 때마다 모든 Buffer를 새 배열로 복사하므로 그 push 한 번이 길고,
+// 복사하는 동안 예전 배열과 새 배열이 같이 있어서 peak 메모리가 커진다.
+// peak RSS는 container마다 fork한 자식 프로세스에서 잰다.
+
+struct Buffer
+{
+    int     idx;
+    char    buff[4096];
+};
+
+typedef ft::stack<Buffer, ft::vector<Buffer> >  vector_stack;
+typedef ft::stack<Buffer, ft::deque<Buffer> >   deque_stack;
+typedef ft::stack<Buffer, std::deque<Buffer> >  std_deque_stack;
+
+template <typename Stack>
+void measure(const char* name, int count)
+{
+    bench::title(name);
+    long rss_before = bench::rss_kb();
+    Buffer buffer;
+    buffer.idx = 0;
+    buffer.buff[0] = 0;
+    double worst_push = 0;
+    long sum = 0;
+
+    bench::timer total;
+    {
+        Stack stack;
+        for (int i = 0; i < count; i++)
+        {
+            buffer.idx = i;
+            bench::timer t;
+            stack.push(buffer);
+            double ms = t.elapsed_ms();
+            if (ms > worst_push)
+                worst_push = ms;
+        }
+        bench::report("push", total.elapsed_ms());
+        bench::report("slowest single push", worst_push);
+        bench::report("peak RSS growth", (bench::peak_rss_kb() - rss_before) / 1024.0, "MB");
+        bench::report("data size", count * sizeof(Buffer) / 1024.0 / 1024.0, "MB");
+
+        bench::timer t;
+        while (!stack.empty())
+        {
+            sum += stack.top().idx;
+            stack.pop();
+        }
+        bench::report("pop", t.elapsed_ms());
+    }
+    bench::sink = sum;
+}
+
+template <typename Stack>
+void run_in_child(const char* name, int count)
+{
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        measure<Stack>(name, count);
+        std::cout.flush();
+        _exit(0);
+    }
+    if (pid > 0)
+        waitpid(pid, NULL, 0);
+    else
+        measure<Stack>(name, count);
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 100000;
+
+    run_in_child<vector_stack>("ft::stack<Buffer, ft::vector<Buffer> >", count);
+    run_in_child<deque_stack>("ft::stack<Buffer, ft::deque<Buffer> >", count);
+    run_in_child<std_deque_stack>("ft::stack<Buffer, std::deque<Buffer> >", count);
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include <cstdlib>
+#include "vector.hpp"
+#include "map.hpp"
+#include "reclaimer.hpp"
+#include "bench.hpp"
+
+// 큰 컨테이너를 버릴 때 부른 쪽이 멈추는 시간.
+//   그냥 해제: 소멸자 / main.cpp의 ft::vector<Buffer>().swap(vector_buffer)
+//   ft::reclaim: 내용을 reclaimer thread로 넘기고 바로 돌아온다. (넘긴 뒤 해제가 끝날 때까지 기다리는 시간은 재지 않는다)
+//   clear_some(budget): 여러 번 나눠 비운다. 한 번 부를 때 가장 오래 걸린 시간과 전체 시간을 본다.
+//                       가장 긴 호출이 1 ms를 넘으면 실패로 보고 0이 아닌 값으로 끝난다.
+//                       가장 긴 호출은 thread CPU 시간으로 잰다. 벽시계로 재면 호출 중에 CPU를 뺏긴 시간(scheduler tick)이 최댓값이 된다.
+
+struct Buffer
+{
+    int     idx;
+    char    buff[4096 - sizeof(int)];
+};
+
+typedef ft::map<int, int>       int_map;
+typedef ft::vector<Buffer>      buffer_vector;
+
+const int budget = 1000;
+const double longest_call_limit_ms = 1.0;
+
+void fill(int_map& m, int count)
+{
+    srand(42);
+    for (int i = 0; i < count; i++)
+        m.insert(ft::make_pair(rand(), i));
+}
+
+void fill(buffer_vector& v, int count)
+{
+    v.resize(count);
+    for (int i = 0; i < count; i++)
+        v[i].idx = i;
+}
+
+template <typename Container>
+double destroy_now(const int& count)
+{
+    Container c;
+    fill(c, count);
+    bench::timer t;
+    Container().swap(c);
+    return t.elapsed_ms();
+}
+
+template <typename Container>
+double destroy_in_background(const int& count)
+{
+    Container c;
+    fill(c, count);
+    bench::timer t;
+    ft::reclaim(c);
+    double ms = t.elapsed_ms();
+    ft::reclaimer::instance().wait();
+    return ms;
+}
+
+// clear_some 한 번에 걸린 가장 긴 시간 (thread CPU 시간)
+template <typename Container>
+double clear_some_max(const int& count)
+{
+    Container c;
+    fill(c, count);
+    double longest = 0;
+    bool done = false;
+    while (!done)
+    {
+        bench::cpu_timer t;
+        done = c.clear_some(budget);
+        double ms = t.elapsed_ms();
+        if (ms > longest)
+            longest = ms;
+    }
+    return longest;
+}
+
+template <typename Container>
+double clear_some_total(const int& count)
+{
+    Container c;
+    fill(c, count);
+    bench::timer t;
+    while (!c.clear_some(budget))
+        ;
+    return t.elapsed_ms();
+}
+
+template <typename Container>
+bool run(const char* name, int count)
+{
+    bench::title(name);
+    bench::report("destroy on the caller", bench::best_of(destroy_now<Container>, count));
+    bench::report("ft::reclaim (caller only)", bench::best_of(destroy_in_background<Container>, count));
+    double longest = bench::best_of(clear_some_max<Container>, count);
+    bench::report("clear_some(1000), longest call", longest);
+    bench::report("clear_some(1000), all calls", bench::best_of(clear_some_total<Container>, count));
+    bool ok = longest < longest_call_limit_ms;
+    std::cout << "  longest clear_some call under " << longest_call_limit_ms << " ms: " << (ok ? "ok" : "FAILED") << std::endl;
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+
+    bool ok = run<int_map>("ft::map<int, int>", count);
+    ok = run<buffer_vector>("ft::vector<Buffer> (4 KB elements)", count / 16) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include "vector.hpp"
+#include "bench.hpp"
+
+// 파일이나 socket에서 읽은 데이터를 ft::vector<Buffer> 끝에 이어 붙이는 비용.
+// resize는 새 Buffer를 모두 0으로 채운 뒤 read가 다시 덮어쓰므로 메모리를 두 번 쓰고,
+// append_default_init은 초기화하지 않은 자리에 read가 바로 쓴다.
+// 커지는 비용은 빼고 보기 위해 두 경우 모두 먼저 reserve한다. (/dev/zero에서 읽는다)
+
+struct Buffer
+{
+    int     idx;
+    char    buff[4096 - sizeof(int)];
+};
+
+namespace ft
+{
+    template <> struct is_trivially_default_constructible<Buffer> : public true_type {};
+    template <> struct is_trivially_relocatable<Buffer> : public true_type {};
+}
+
+typedef ft::vector<Buffer>  buffer_vector;
+
+// 한 번에 읽는 Buffer 수
+const int chunk = 64;
+
+bool read_into(int fd, Buffer* dst, int n)
+{
+    char* p = reinterpret_cast<char*>(dst);
+    size_t left = n * sizeof(Buffer);
+    while (left > 0)
+    {
+        ssize_t got = read(fd, p, left);
+        if (got <= 0)
+            return false;
+        p += got;
+        left -= got;
+    }
+    return true;
+}
+
+double resize_then_read(const int& count)
+{
+    int fd = open("/dev/zero", O_RDONLY);
+    bench::timer t;
+    buffer_vector v;
+    v.reserve(count);
+    for (int i = 0; i < count; i += chunk)
+    {
+        buffer_vector::size_type old_size = v.size();
+        v.resize(old_size + chunk);
+        read_into(fd, &v[old_size], chunk);
+    }
+    bench::sink = v.size();
+    double ms = t.elapsed_ms();
+    close(fd);
+    return ms;
+}
+
+double append_default_init_then_read(const int& count)
+{
+    int fd = open("/dev/zero", O_RDONLY);
+    bench::timer t;
+    buffer_vector v;
+    v.reserve(count);
+    for (int i = 0; i < count; i += chunk)
+        read_into(fd, v.append_default_init(chunk), chunk);
+    bench::sink = v.size();
+    double ms = t.elapsed_ms();
+    close(fd);
+    return ms;
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 65536;
+
+    bench::title("ft::vector<Buffer>, read 4 KB Buffers from /dev/zero");
+    bench::report("resize + read", bench::best_of(resize_then_read, count));
+    bench::report("append_default_init + read", bench::best_of(append_default_init_then_read, count));
+    bench::report("data size", count * sizeof(Buffer) / 1024.0 / 1024.0, "MB");
+    return 0;
+}
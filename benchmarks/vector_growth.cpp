@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <cstdlib>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "vector.hpp"
+#include "deque.hpp"
+#include "bench.hpp"
+
+// ft::vector의 growth policy마다 push_back 한 번의 지연 분포(p50 / p99 / max)와 peak RSS를 잰다.
+// 재할당하는 push_back은 그때까지의 원소를 모두 옮기므로 max가 원소 수에 비례해 커진다.
+// vector는 연속 메모리를 보장해야 해서 옮기는 일을 여러 push_back에 나눌 수 없다.
+// 지연 상한이 필요하면 block 단위로 늘어나는 ft::deque를 쓰면 되므로 같이 비교한다.
+// peak RSS는 container마다 fork한 자식 프로세스에서 잰다.
+
+struct Buffer
+{
+    int     idx;
+    char    buff[512];
+};
+
+typedef ft::vector<Buffer, std::allocator<Buffer>, ft::vector_growth_double>               double_vector;
+typedef ft::vector<Buffer, std::allocator<Buffer>, ft::vector_growth_1_5>                  one_half_vector;
+typedef ft::vector<Buffer, std::allocator<Buffer>, ft::vector_growth_page_rounded<> >      page_vector;
+typedef ft::deque<Buffer>                                                                   deque_type;
+
+inline double now_us()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000.0 + tv.tv_usec;
+}
+
+// 정렬된 지연 시간에서 p번째 백분위 값
+double percentile(ft::vector<double>& sorted, double p)
+{
+    ft::vector<double>::size_type i = static_cast<ft::vector<double>::size_type>(p / 100.0 * (sorted.size() - 1));
+    return sorted[i];
+}
+
+template <typename Container>
+void measure(const char* name, int count)
+{
+    bench::title(name);
+    ft::vector<double> latency;
+    latency.reserve(count);
+    long rss_before = bench::rss_kb();
+    Buffer buffer;
+    buffer.idx = 0;
+    buffer.buff[0] = 0;
+
+    bench::timer total;
+    {
+        Container c;
+        for (int i = 0; i < count; i++)
+        {
+            buffer.idx = i;
+            double start = now_us();
+            c.push_back(buffer);
+            latency.push_back(now_us() - start);
+        }
+        bench::report("push_back", total.elapsed_ms());
+        bench::report("peak RSS growth", (bench::peak_rss_kb() - rss_before) / 1024.0, "MB");
+        bench::report("data size", count * sizeof(Buffer) / 1024.0 / 1024.0, "MB");
+        bench::sink = c.size();
+    }
+    std::sort(latency.begin(), latency.end());
+    bench::report("push_back p50", percentile(latency, 50), "us");
+    bench::report("push_back p99", percentile(latency, 99), "us");
+    bench::report("push_back p99.99", percentile(latency, 99.99), "us");
+    bench::report("push_back max", latency.back(), "us");
+}
+
+template <typename Container>
+void run_in_child(const char* name, int count)
+{
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        measure<Container>(name, count);
+        std::cout.flush();
+        _exit(0);
+    }
+    if (pid > 0)
+        waitpid(pid, NULL, 0);
+    else
+        measure<Container>(name, count);
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 200000;
+
+    run_in_child<double_vector>("ft::vector, vector_growth_double (default)", count);
+    run_in_child<one_half_vector>("ft::vector, vector_growth_1_5", count);
+    run_in_child<page_vector>("ft::vector, vector_growth_page_rounded<>", count);
+    run_in_child<deque_type>("ft::deque", count);
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <cstdlib>
+#include <string>
+#include "vector.hpp"
+#include "map.hpp"
+#include "bench.hpp"
+
+// main.cpp의 vector_str처럼 힙에 올라가는 std::string을 담은 ft::vector가 커질 때의 비용.
+// C++98 빌드(vector_move)에서는 재할당할 때마다 모든 string을 새로 복사하고,
+// C++11 빌드(vector_move_cxx11)에서는 move 생성자로 포인터만 옮긴다.
+
+typedef ft::vector<std::string>         string_vector;
+typedef ft::map<int, std::string>       string_map;
+
+// SSO에 들어가지 않는 길이
+const std::string::size_type length = 48;
+
+double push_back_grow(const int& count)
+{
+    bench::timer t;
+    string_vector v;
+    for (int i = 0; i < count; i++)
+        v.push_back(std::string(length, 'a' + i % 26));
+    bench::sink = v.size();
+    return t.elapsed_ms();
+}
+
+double reserve_full(const int& count)
+{
+    string_vector v(count, std::string(length, 'r'));
+    bench::timer t;
+    v.reserve(v.capacity() * 2);
+    bench::sink = v.capacity();
+    return t.elapsed_ms();
+}
+
+double insert_front(const int& count)
+{
+    string_vector v(count, std::string(length, 'i'));
+    bench::timer t;
+    for (int i = 0; i < 100; i++)
+        v.insert(v.begin(), std::string(length, 'f'));
+    bench::sink = v.size();
+    return t.elapsed_ms();
+}
+
+double map_subscript(const int& count)
+{
+    bench::timer t;
+    string_map m;
+    for (int i = 0; i < count; i++)
+        m[i] = std::string(length, 'm');
+    bench::sink = m.size();
+    return t.elapsed_ms();
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+
+#if __cplusplus >= 201103L
+    bench::title("ft::vector<std::string>, C++11 (move)");
+#else
+    bench::title("ft::vector<std::string>, C++98 (copy)");
+#endif
+    bench::report("push_back, growing from empty", bench::best_of(push_back_grow, count));
+    bench::report("reserve(capacity * 2) on a full vector", bench::best_of(reserve_full, count));
+    bench::report("insert at begin x100", bench::best_of(insert_front, count / 10));
+    bench::report("map<int, std::string>::operator[] =", bench::best_of(map_subscript, count));
+    return 0;
+}
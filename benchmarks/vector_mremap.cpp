@@ -0,0 +1,100 @@
+#include <cstdlib>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "vector.hpp"
+#include "mmap_allocator.hpp"
+#include "bench.hpp"
+
+// 4 KB Buffer를 push_back으로 수백 MB ~ 수 GB까지 쌓으면서
+// std::allocator와 ft::mmap_allocator(mremap)의 시간과 peak RSS를 비교한다.
+// std::allocator는 capacity가 찰 때마다 새 buffer에 전부 복사하므로 그 순간 예전 buffer와 새 buffer가 같이 있고,
+// mmap_allocator는 mremap으로 page를 옮기기만 해서 peak RSS가 data 크기 정도에 머문다.
+//   ./vector_mremap 1024 4096 8192    (크기는 MB, 기본값은 256 1024)
+// peak RSS는 container마다 fork한 자식 프로세스에서 잰다.
+
+struct Buffer
+{
+    int     idx;
+    char    buff[4096 - sizeof(int)];
+};
+
+namespace ft
+{
+    template <> struct is_trivially_relocatable<Buffer> : public true_type {};
+}
+
+typedef ft::vector<Buffer>                                          std_vector;
+typedef ft::vector<Buffer, ft::mmap_allocator<Buffer> >             mremap_vector;
+typedef ft::vector<Buffer, ft::mmap_allocator<Buffer, true> >       huge_page_vector;
+
+template <typename Vector>
+void measure(const char* name, long count)
+{
+    bench::title(name);
+    long rss_before = bench::rss_kb();
+    Buffer buffer;
+    buffer.buff[0] = 0;
+    double worst_push = 0;
+
+    bench::timer total;
+    {
+        Vector v;
+        for (long i = 0; i < count; i++)
+        {
+            buffer.idx = i;
+            bench::timer t;
+            v.push_back(buffer);
+            double ms = t.elapsed_ms();
+            if (ms > worst_push)
+                worst_push = ms;
+        }
+        bench::report("push_back", total.elapsed_ms());
+        bench::report("slowest single push_back", worst_push);
+        bench::report("peak RSS growth", (bench::peak_rss_kb() - rss_before) / 1024.0, "MB");
+        bench::report("data size", count * sizeof(Buffer) / 1024.0 / 1024.0, "MB");
+        bench::sink = v.back().idx;
+    }
+}
+
+template <typename Vector>
+void run_in_child(const char* name, long count)
+{
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        measure<Vector>(name, count);
+        std::cout.flush();
+        _exit(0);
+    }
+    if (pid > 0)
+        waitpid(pid, NULL, 0);
+    else
+        measure<Vector>(name, count);
+}
+
+void run(long megabytes)
+{
+    // capacity가 딱 찬 뒤에 하나를 더 넣어서 마지막 push_back이 재할당하게 한다. (peak RSS가 가장 커지는 경우)
+    long count = megabytes * 1024 * 1024 / sizeof(Buffer) + 1;
+
+    std::cout << std::endl << "---- " << megabytes << " MB ----" << std::endl;
+    run_in_child<std_vector>("ft::vector<Buffer> (std::allocator)", count);
+    run_in_child<mremap_vector>("ft::vector<Buffer, ft::mmap_allocator<Buffer> >", count);
+    run_in_child<huge_page_vector>("ft::vector<Buffer, ft::mmap_allocator<Buffer, true> >", count);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; i++)
+            run(atol(argv[i]));
+    }
+    else
+    {
+        run(256);
+        run(1024);
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <cstdlib>
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <string>
+#include "vector.hpp"
+#include "map.hpp"
+#include "bench.hpp"
+
+// range constructor / assign / range insert가 입력 범위를 몇 번 읽는지에 따른 비용.
+// random access iterator는 길이를 뺄셈으로 구하고, list iterator는 길이를 세느라 한 번 더 걷고,
+// istream_iterator는 길이를 세지 않고 한 번만 읽으면서 늘려 간다.
+
+struct Args
+{
+    ft::vector<int>     values;
+    std::list<int>      list;
+    std::string         text;
+};
+
+double from_vector(const Args& args)
+{
+    bench::timer t;
+    ft::vector<int> v(args.values.begin(), args.values.end());
+    v.insert(v.begin() + v.size() / 2, args.values.begin(), args.values.end());
+    v.assign(args.values.begin(), args.values.end());
+    bench::sink = v.size();
+    return t.elapsed_ms();
+}
+
+double from_list(const Args& args)
+{
+    bench::timer t;
+    ft::vector<int> v(args.list.begin(), args.list.end());
+    v.insert(v.begin() + v.size() / 2, args.list.begin(), args.list.end());
+    v.assign(args.list.begin(), args.list.end());
+    bench::sink = v.size();
+    return t.elapsed_ms();
+}
+
+double from_istream(const Args& args)
+{
+    std::istringstream in1(args.text), in2(args.text), in3(args.text);
+    bench::timer t;
+    ft::vector<int> v((std::istream_iterator<int>(in1)), std::istream_iterator<int>());
+    v.insert(v.begin() + v.size() / 2, std::istream_iterator<int>(in2), std::istream_iterator<int>());
+    v.assign(std::istream_iterator<int>(in3), std::istream_iterator<int>());
+    bench::sink = v.size();
+    return t.elapsed_ms();
+}
+
+// ft::distance: map iterator는 한 칸씩, vector iterator는 뺄셈 한 번
+double distance_map(const Args& args)
+{
+    ft::map<int, int> m;
+    for (int i = 0; i < 1000; i++)
+        m[args.values[i]];
+    bench::timer t;
+    long sum = 0;
+    for (int i = 0; i < 10000; i++)
+        sum += ft::distance(m.begin(), m.end());
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+double distance_vector(const Args& args)
+{
+    bench::timer t;
+    long sum = 0;
+    for (int i = 0; i < 10000; i++)
+        sum += ft::distance(args.values.begin(), args.values.end() - (i & 1));
+    bench::sink = sum;
+    return t.elapsed_ms();
+}
+
+int main(int argc, char** argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+    Args args;
+    std::ostringstream out;
+
+    srand(42);
+    for (int i = 0; i < count; i++)
+    {
+        int x = rand();
+        args.values.push_back(x);
+        args.list.push_back(x);
+        out << x << ' ';
+    }
+    args.text = out.str();
+
+    bench::title("ft::vector<int> range ctor + insert + assign");
+    bench::report("ft::vector iterator (random access)", bench::best_of(from_vector, args));
+    bench::report("std::list iterator (bidirectional)", bench::best_of(from_list, args));
+    bench::report("std::istream_iterator (input)", bench::best_of(from_istream, args));
+
+    bench::title("ft::distance x10000");
+    bench::report("ft::map, 1000 elements", bench::best_of(distance_map, args));
+    bench::report("ft::vector", bench::best_of(distance_vector, args));
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <cstdlib>
+#include "vector.hpp"
+#include "bench.hpp"
+
+// ft::vector의 reserve / insert / erase 가 원소를 옮기는 비용을
+// 원소별 construct + destroy 경로와 memmove 경로로 나눠 비교한다.
+//
+// int / Int, Buffer / RelocatableBuffer는 -O2에서 차이가 잡음 수준이다. (1 CPU, 50000개 기준)
+// Int와 Buffer는 복사 생성자가 trivial해서 컴파일러가 원소별 loop를 이미 memmove와 같은 코드로 만든다.
+// 그래서 erase(first, last) + insert(pos, n, x)는 memmove 쪽이 오히려 조금 느리게 나온 적도 있고(425 vs 420 ms),
+// insert / erase 한 개도 몇 % 안팎에서 오르내린다. memmove 경로가 확실히 빠른 것은
+// 복사 생성자 / 소멸자가 실제로 일을 하는데 opt-in 한 타입이다. (아래 Handle / RelocatableHandle)
+
+#define BUFFER_SIZE 4096
+
+struct Buffer
+{
+    int idx;
+    char buff[BUFFER_SIZE];
+};
+
+// Buffer와 레이아웃이 같지만 trivially relocatable로 opt-in 한 타입
+struct RelocatableBuffer
+{
+    int idx;
+    char buff[BUFFER_SIZE];
+};
+
+// int와 같지만 opt-in 하지 않아서 원소별 경로를 타는 타입
+struct Int
+{
+    int value;
+    Int(int v = 0): value(v) {}
+};
+
+// 참조 횟수를 세는 handle. 복사하면 횟수를 올리고 소멸하면 내리므로 원소별 경로는 옮길 때마다 이 일을 한다.
+static long handle_count = 0;
+
+struct Handle
+{
+    long* count;
+    Handle(int = 0): count(&handle_count) { ++*count; }
+    Handle(const Handle& x): count(x.count) { ++*count; }
+    Handle& operator=(const Handle& x) { ++*x.count; --*count; count = x.count; return *this; }
+    ~Handle() { --*count; }
+};
+
+// Handle과 같지만 opt-in 한 타입. 옮길 때 횟수가 바뀌지 않으므로 memmove로 옮겨도 된다.
+struct RelocatableHandle
+{
+    long* count;
+    RelocatableHandle(int = 0): count(&handle_count) { ++*count; }
+    RelocatableHandle(const RelocatableHandle& x): count(x.count) { ++*count; }
+    RelocatableHandle& operator=(const RelocatableHandle& x) { ++*x.count; --*count; count = x.count; return *this; }
+    ~RelocatableHandle() { --*count; }
+};
+
+namespace ft
+{
+    template <>
+    struct is_trivially_relocatable<RelocatableBuffer> : public true_type {};
+
+    template <>
+    struct is_trivially_relocatable<RelocatableHandle> : public true_type {};
+}
+
+template <typename T>
+double push_back_growth(int count)
+{
+    bench::timer t;
+    ft::vector<T> v;
+    for (int i = 0; i < count; i++)
+    {
+        v.push_back(T());
+        v.back().idx = i;
+    }
+    bench::sink = v[count / 2].idx;
+    return t.elapsed_ms();
+}
+
+template <typename T>
+double insert_front(int count)
+{
+    ft::vector<T> v;
+    v.reserve(count);
+    bench::timer t;
+    for (int i = 0; i < count; i++)
+        v.insert(v.begin(), T(i));
+    bench::sink = v.size();
+    return t.elapsed_ms();
+}
+
+template <typename T>
+double erase_front(int count)
+{
+    ft::vector<T> v(count, T(1));
+    bench::timer t;
+    while (!v.empty())
+        v.erase(v.begin());
+    bench::sink = v.size();
+    return t.elapsed_ms();
+}
+
+template <typename T>
+double erase_range(int count, int rounds)
+{
+    ft::vector<T> v(count, T(1));
+    bench::timer t;
+    for (int i = 0; i < rounds; i++)
+    {
+        v.erase(v.begin(), v.begin() + 8);
+        v.insert(v.begin(), 8, T(2));
+    }
+    bench::sink = v.size();
+    return t.elapsed_ms();
+}
+
+int main(int argc, char** argv)
+{
+    int buffers = (argc > 1) ? atoi(argv[1]) : 50000;
+    int ints = (argc > 2) ? atoi(argv[2]) : 50000;
+
+    bench::title("push_back growth, 4 KB Buffer x " + std::string(argc > 1 ? argv[1] : "50000"));
+    bench::report("element-wise (Buffer)", push_back_growth<Buffer>(buffers));
+    bench::report("memmove (RelocatableBuffer)", push_back_growth<RelocatableBuffer>(buffers));
+
+    bench::title("insert(begin(), x), int");
+    bench::report("element-wise (Int)", insert_front<Int>(ints));
+    bench::report("memmove (int)", insert_front<int>(ints));
+
+    bench::title("erase(begin()), int");
+    bench::report("element-wise (Int)", erase_front<Int>(ints));
+    bench::report("memmove (int)", erase_front<int>(ints));
+
+    bench::title("erase(first, last) + insert(pos, n, x), int");
+    bench::report("element-wise (Int)", erase_range<Int>(ints * 4, 5000));
+    bench::report("memmove (int)", erase_range<int>(ints * 4, 5000));
+
+    bench::title("insert(begin(), x), reference-counting handle");
+    bench::report("element-wise (Handle)", insert_front<Handle>(ints));
+    bench::report("memmove (RelocatableHandle)", insert_front<RelocatableHandle>(ints));
+
+    bench::title("erase(first, last) + insert(pos, n, x), reference-counting handle");
+    bench::report("element-wise (Handle)", erase_range<Handle>(ints * 4, 5000));
+    bench::report("memmove (RelocatableHandle)", erase_range<RelocatableHandle>(ints * 4, 5000));
+    return 0;
+}
@@ -0,0 +1,1006 @@
+#ifndef BTREE_HPP
+#define BTREE_HPP
+
+#include <memory>
+#include <functional>
+#include <cstddef>
+#include <cstring>
+#include "reverse_iterator.hpp"
+#include "iterator_base.hpp"
+#include "algorithm.hpp"
+#include "pair.hpp"
+#include "type_traits.hpp"
+
+// 노드 하나의 목표 크기(byte). 64 byte 캐시 라인 4개
+#ifndef FT_BTREE_NODE_BYTES
+# define FT_BTREE_NODE_BYTES 256
+#endif
+
+namespace ft
+{
+    // =========================================btree node slots=========================================
+    // 노드 header(부모 포인터, 위치, 개수)를 뺀 나머지에 값이 몇 개 들어가는지. 최소 3개, 최대 255개
+    template <typename T>
+    struct btree_node_slots
+    {
+        static const std::size_t header_size = sizeof(void*) * 2;
+        static const std::size_t fit = (FT_BTREE_NODE_BYTES > header_size + sizeof(T) * 3) ? (FT_BTREE_NODE_BYTES - header_size) / sizeof(T) : 3;
+        static const std::size_t value = (fit > 255) ? 255 : fit;
+    };
+
+    template <typename T>
+    class btree_internal_node;
+
+    // ============================================btree node============================================
+    // rb_tree는 값 하나마다 노드가 따로 할당되어서 find가 한 단계 내려갈 때마다 다른 캐시 라인을 읽는다.
+    // btree 노드는 값 여러 개를 배열(_slots)에 붙여 두고 노드 안에서는 이분 탐색을 하므로,
+    // 한 단계에서 읽는 메모리가 연속이고 높이는 log(slots) n으로 줄어든다.
+    // leaf 노드는 값만 가지고, internal 노드(btree_internal_node)는 그 뒤에 자식 포인터 배열을 더 가진다.
+    // 값 i는 자식 i와 자식 i + 1 사이에 있다.
+    template <typename T>
+    class btree_node
+    {
+        public:
+            typedef T                                   value_type;
+            typedef btree_node<value_type>*             node_ptr;
+            typedef const btree_node<value_type>*       const_node_ptr;
+            static const std::size_t                    slots = btree_node_slots<value_type>::value;
+
+            node_ptr        _parent;        // root면 NULL
+            unsigned short  _position;      // 부모의 자식 배열에서 자신의 index
+            unsigned short  _count;
+            bool            _leaf;
+
+        private:
+            // 값은 필요할 때 allocator의 construct로 만든다. 정렬을 맞추기 위해 union으로 둔다.
+            union
+            {
+                char        _bytes[sizeof(value_type) * slots];
+                void*       _align_pointer;
+                long        _align_long;
+                long double _align_long_double;
+            }               _slots;
+
+        public:
+            value_type* values() { return reinterpret_cast<value_type*>(_slots._bytes); }
+            const value_type* values() const { return reinterpret_cast<const value_type*>(_slots._bytes); }
+            value_type& value(int i) { return this->values()[i]; }
+            const value_type& value(int i) const { return this->values()[i]; }
+
+            void init(bool leaf)
+            {
+                _parent = NULL;
+                _position = 0;
+                _count = 0;
+                _leaf = leaf;
+            }
+
+            // internal 노드에서만 부른다.
+            node_ptr child(int i) const { return static_cast<const btree_internal_node<value_type>*>(this)->_children[i]; }
+            void set_child(int i, node_ptr node)
+            {
+                static_cast<btree_internal_node<value_type>*>(this)->_children[i] = node;
+                node->_parent = this;
+                node->_position = static_cast<unsigned short>(i);
+            }
+    };
+
+    template <typename T>
+    class btree_internal_node : public btree_node<T>
+    {
+        public:
+            typename btree_node<T>::node_ptr    _children[btree_node<T>::slots + 1];
+    };
+
+    // =========================================Utility function=========================================
+    // (node, position) 다음 값의 위치. 마지막 값이었으면 end() 위치(가장 오른쪽 leaf, _count)가 된다.
+    template <typename NodePtr>
+    void btree_increment(NodePtr& node, int& position)
+    {
+        if (node->_leaf)
+        {
+            if (++position < node->_count)
+                return ;
+            NodePtr last = node;
+            int last_position = position;
+            while (position == node->_count && node->_parent != NULL)
+            {
+                position = node->_position;
+                node = node->_parent;
+            }
+            if (position == node->_count)
+            {
+                node = last;
+                position = last_position;
+            }
+        }
+        else
+        {
+            node = node->child(position + 1);
+            while (!node->_leaf)
+                node = node->child(0);
+            position = 0;
+        }
+    }
+
+    template <typename NodePtr>
+    void btree_decrement(NodePtr& node, int& position)
+    {
+        if (node->_leaf)
+        {
+            if (--position >= 0)
+                return ;
+            NodePtr first = node;
+            while (position < 0 && node->_parent != NULL)
+            {
+                position = node->_position - 1;
+                node = node->_parent;
+            }
+            if (position < 0)
+            {
+                node = first;
+                position = -1;
+            }
+        }
+        else
+        {
+            node = node->child(position);
+            while (!node->_leaf)
+                node = node->child(node->_count);
+            position = node->_count - 1;
+        }
+    }
+
+    // ============================================Iterators============================================
+    // 값이 노드 사이를 옮겨 다니므로 insert / erase 뒤에는 모든 iterator가 무효가 된다. (std::map과 다른 점)
+    template <typename node_ptr, typename T>
+    class btree_iterator
+    {
+        public:
+            typedef ft::bidirectional_iterator_tag      iterator_category;
+            typedef std::ptrdiff_t                      difference_type;
+            typedef T                                   value_type;
+            typedef T*                                  pointer;
+            typedef T&                                  reference;
+
+        private:
+            node_ptr    _node;
+            int         _position;
+
+        public:
+            btree_iterator(): _node(), _position() {}
+            btree_iterator(const btree_iterator& iter): _node(iter._node), _position(iter._position) {}
+            btree_iterator(node_ptr node, int position): _node(node), _position(position) {}
+            btree_iterator& operator=(const btree_iterator& iter)
+            {
+                _node = iter._node;
+                _position = iter._position;
+                return *this;
+            }
+            reference operator*() const { return _node->value(_position); }
+            pointer operator->() const { return &_node->value(_position); }
+            btree_iterator& operator++()
+            {
+                if (_node->_leaf && _position + 1 < _node->_count)
+                    ++_position;
+                else
+                    btree_increment(_node, _position);
+                return *this;
+            }
+            btree_iterator operator++(int)
+            {
+                btree_iterator rtn(*this);
+                ++(*this);
+                return rtn;
+            }
+            btree_iterator& operator--()
+            {
+                if (_node->_leaf && _position > 0)
+                    --_position;
+                else
+                    btree_decrement(_node, _position);
+                return *this;
+            }
+            btree_iterator operator--(int)
+            {
+                btree_iterator rtn(*this);
+                --(*this);
+                return rtn;
+            }
+            node_ptr base() const { return _node; }
+            int position() const { return _position; }
+    };
+
+    template<typename node_ptr, typename T>
+    bool operator==(const btree_iterator<node_ptr, T>& rhs, const btree_iterator<node_ptr, T>& lhs)
+    { return rhs.base() == lhs.base() && rhs.position() == lhs.position(); }
+
+    template<typename node_ptr, typename T>
+    bool operator!=(const btree_iterator<node_ptr, T>& rhs, const btree_iterator<node_ptr, T>& lhs)
+    { return !(rhs == lhs); }
+
+    // =========================================Const Iterators=========================================
+    template <typename const_node_ptr, typename T>
+    class btree_const_iterator
+    {
+        public:
+            typedef ft::bidirectional_iterator_tag                                          iterator_category;
+            typedef std::ptrdiff_t                                                          difference_type;
+            typedef T                                                                       value_type;
+            typedef const T*                                                                pointer;
+            typedef const T&                                                                reference;
+            typedef btree_iterator<typename btree_node<value_type>::node_ptr, value_type>   origin_iterator;
+
+        private:
+            const_node_ptr  _node;
+            int             _position;
+
+        public:
+            btree_const_iterator(): _node(), _position() {}
+            btree_const_iterator(const btree_const_iterator& iter): _node(iter._node), _position(iter._position) {}
+            btree_const_iterator(const origin_iterator& iter): _node(iter.base()), _position(iter.position()) {}
+            btree_const_iterator(const_node_ptr node, int position): _node(node), _position(position) {}
+            btree_const_iterator& operator=(const btree_const_iterator& iter)
+            {
+                _node = iter._node;
+                _position = iter._position;
+                return *this;
+            }
+            reference operator*() const { return _node->value(_position); }
+            pointer operator->() const { return &_node->value(_position); }
+            btree_const_iterator& operator++()
+            {
+                if (_node->_leaf && _position + 1 < _node->_count)
+                    ++_position;
+                else
+                    btree_increment(_node, _position);
+                return *this;
+            }
+            btree_const_iterator operator++(int)
+            {
+                btree_const_iterator rtn(*this);
+                ++(*this);
+                return rtn;
+            }
+            btree_const_iterator& operator--()
+            {
+                if (_node->_leaf && _position > 0)
+                    --_position;
+                else
+                    btree_decrement(_node, _position);
+                return *this;
+            }
+            btree_const_iterator operator--(int)
+            {
+                btree_const_iterator rtn(*this);
+                --(*this);
+                return rtn;
+            }
+            const_node_ptr base() const { return _node; }
+            int position() const { return _position; }
+    };
+
+    template<typename const_node_ptr, typename T>
+    inline bool operator==(const btree_const_iterator<const_node_ptr, T>& rhs, const btree_const_iterator<const_node_ptr, T>& lhs)
+    { return rhs.base() == lhs.base() && rhs.position() == lhs.position(); }
+
+    template<typename const_node_ptr, typename T>
+    inline bool operator!=(const btree_const_iterator<const_node_ptr, T>& rhs, const btree_const_iterator<const_node_ptr, T>& lhs)
+    { return !(rhs == lhs); }
+
+    template<typename const_node_ptr, typename node_ptr, typename T>
+    inline bool operator==(const btree_const_iterator<const_node_ptr, T>& rhs, const btree_iterator<node_ptr, T>& lhs)
+    { return rhs.base() == lhs.base() && rhs.position() == lhs.position(); }
+
+    template<typename const_node_ptr, typename node_ptr, typename T>
+    inline bool operator!=(const btree_const_iterator<const_node_ptr, T>& rhs, const btree_iterator<node_ptr, T>& lhs)
+    { return !(rhs == lhs); }
+
+    template<typename node_ptr, typename const_node_ptr, typename T>
+    inline bool operator==(const btree_iterator<node_ptr, T>& rhs, const btree_const_iterator<const_node_ptr, T>& lhs)
+    { return rhs.base() == lhs.base() && rhs.position() == lhs.position(); }
+
+    template<typename node_ptr, typename const_node_ptr, typename T>
+    inline bool operator!=(const btree_iterator<node_ptr, T>& rhs, const btree_const_iterator<const_node_ptr, T>& lhs)
+    { return !(rhs == lhs); }
+
+    // ==============================================B tree==============================================
+    // rb_tree와 같은 인터페이스를 가진 B-tree. btree_map / btree_set이 쓴다.
+    // 노드가 가득 차면 반으로 나눠서 가운데 값을 부모로 올리고(split),
+    // 최소 개수(slots / 2)보다 적어지면 형제와 합치거나(merge) 형제에게서 값을 빌려온다.
+    // 비어 있으면 노드가 하나도 없고, end()는 (가장 오른쪽 leaf, _count) 위치다.
+    template <typename T, typename Compare = std::less<T>, typename Alloc = std::allocator<T> >
+    class btree
+    {
+        public:
+            typedef ft::btree_node<T>                                               node_type;
+            typedef ft::btree_internal_node<T>                                      internal_node_type;
+            typedef T                                                               value_type;
+            typedef Compare                                                         value_compare;
+            typedef Alloc                                                           allocator_type;
+            typedef typename allocator_type::template rebind<node_type>::other      leaf_alloc_type;
+            typedef typename allocator_type::template rebind<internal_node_type>::other internal_alloc_type;
+            typedef typename allocator_type::pointer                                pointer;
+            typedef typename allocator_type::const_pointer                          const_pointer;
+            typedef typename allocator_type::reference                              reference;
+            typedef typename allocator_type::const_reference                        const_reference;
+            typedef std::ptrdiff_t                                                  difference_type;
+            typedef std::size_t                                                     size_type;
+            typedef typename node_type::node_ptr                                    node_ptr;
+            typedef typename node_type::const_node_ptr                              const_node_ptr;
+            typedef ft::btree_iterator<node_ptr, value_type>                        iterator;
+            typedef ft::btree_const_iterator<const_node_ptr, value_type>            const_iterator;
+            typedef ft::reverse_iterator<iterator>                                  reverse_iterator;
+            typedef ft::reverse_iterator<const_iterator>                            const_reverse_iterator;
+
+        private:
+            static const int    max_count = static_cast<int>(node_type::slots);
+            static const int    min_count = static_cast<int>(node_type::slots) / 2;
+
+            node_ptr            _root;
+            node_ptr            _leftmost;      // begin()이 있는 leaf
+            node_ptr            _rightmost;     // end()가 있는 leaf
+            size_type           _size;
+            value_compare       _compare;
+            allocator_type      _value_alloc;
+            leaf_alloc_type     _leaf_alloc;
+            internal_alloc_type _internal_alloc;
+
+        public:
+            btree(const value_compare &comp, const allocator_type &alloc)
+                : _root(NULL), _leftmost(NULL), _rightmost(NULL), _size(), _compare(comp), _value_alloc(alloc), _leaf_alloc(alloc), _internal_alloc(alloc) {}
+            btree(const btree &obj)
+                : _root(NULL), _leftmost(NULL), _rightmost(NULL), _size(), _compare(obj._compare), _value_alloc(obj._value_alloc), _leaf_alloc(obj._leaf_alloc), _internal_alloc(obj._internal_alloc)
+            {
+                this->copy_from(obj);
+            }
+            ~btree() { this->clear(); }
+            btree& operator=(const btree &obj)
+            {
+                if (this != &obj)
+                {
+                    this->clear();
+                    this->_compare = obj._compare;
+                    this->copy_from(obj);
+                }
+                return *this;
+            }
+#if __cplusplus >= 201103L
+            // 노드는 움직이지 않고 빈 트리와 바꾼다.
+            btree(btree&& obj)
+                : _root(NULL), _leftmost(NULL), _rightmost(NULL), _size(), _compare(obj._compare), _value_alloc(obj._value_alloc), _leaf_alloc(obj._leaf_alloc), _internal_alloc(obj._internal_alloc)
+            {
+                this->swap(obj);
+            }
+            btree& operator=(btree&& obj)
+            {
+                if (this != &obj)
+                {
+                    this->clear();
+                    this->swap(obj);
+                }
+                return *this;
+            }
+#endif
+
+            iterator begin() { return iterator(_leftmost, 0); }
+            const_iterator begin() const { return const_iterator(_leftmost, 0); }
+            iterator end() { return iterator(_rightmost, _rightmost ? _rightmost->_count : 0); }
+            const_iterator end() const { return const_iterator(_rightmost, _rightmost ? _rightmost->_count : 0); }
+            reverse_iterator rbegin() { return reverse_iterator(end()); }
+            const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+            reverse_iterator rend() { return reverse_iterator(begin()); }
+            const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+            bool empty() const { return _size == 0; }
+            size_type size() const { return _size; }
+            size_type max_size() const { return _value_alloc.max_size(); }
+
+            // root부터 내려가면서 노드마다 이분 탐색으로 자리를 찾는다. 값은 항상 leaf에 새로 들어간다.
+            ft::pair<iterator, bool> insert(const value_type& val)
+            {
+                if (_root == NULL)
+                    return ft::make_pair(this->insert_at(NULL, 0, val), true);
+                node_ptr node = _root;
+                while (true)
+                {
+                    int i = this->lower_position(node, val);
+                    if (i < node->_count && !this->_compare(val, node->value(i)))
+                        return ft::make_pair(iterator(node, i), false);
+                    if (node->_leaf)
+                        return ft::make_pair(this->insert_at(node, i, val), true);
+                    node = node->child(i);
+                }
+            }
+
+            // position 바로 앞 또는 바로 뒤에 val이 들어갈 자리가 있으면 root부터 내려가지 않는다.
+            iterator insert(const_iterator position, const value_type& val)
+            {
+                iterator pos(const_cast<node_ptr>(position.base()), position.position());
+
+                if (_root == NULL)
+                    return this->insert(val).first;
+                if (pos == this->end() || this->_compare(val, *pos))
+                {
+                    if (pos == this->begin() || this->_compare(*(--iterator(pos)), val))
+                        return this->insert_before(pos, val);
+                }
+                else if (this->_compare(*pos, val))
+                {
+                    iterator next = pos;
+                    ++next;
+                    if (next == this->end() || this->_compare(val, *next))
+                        return this->insert_before(next, val);
+                }
+                else
+                    return pos;
+                return this->insert(val).first;
+            }
+
+            // 정렬된 범위라면 end() 힌트가 매번 맞아서 가장 오른쪽 leaf에 이어 붙이게 된다.
+            template<typename InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                    this->insert(this->end(), *first);
+            }
+
+            // 지운 값 다음 값을 가리키는 iterator를 돌려준다.
+            iterator erase(const_iterator position)
+            {
+                node_ptr node = const_cast<node_ptr>(position.base());
+                int pos = position.position();
+                bool internal_delete = !node->_leaf;
+
+                this->_value_alloc.destroy(node->values() + pos);
+                if (internal_delete)
+                {
+                    // 바로 앞 값(왼쪽 subtree의 가장 큰 값)은 leaf의 마지막 값이다. 그 값을 지운 자리로 올리고 leaf에서 뺀다.
+                    node_ptr leaf = node->child(pos);
+                    while (!leaf->_leaf)
+                        leaf = leaf->child(leaf->_count);
+                    this->relocate(node->values() + pos, leaf->values() + leaf->_count - 1, 1);
+                    node = leaf;
+                    pos = leaf->_count - 1;
+                }
+                this->relocate(node->values() + pos, node->values() + pos + 1, node->_count - pos - 1);
+                --node->_count;
+                --this->_size;
+
+                // 다음 값은 지금 (next, next_position)에 있다. 값을 옮기는 동안 같이 따라간다.
+                node_ptr next = node;
+                int next_position = pos;
+                this->rebalance_after_erase(node, next, next_position);
+                if (_root == NULL)
+                    return this->end();
+                while (next_position == next->_count && next->_parent != NULL)
+                {
+                    next_position = next->_position;
+                    next = next->_parent;
+                }
+                if (next_position == next->_count)
+                    return this->end();
+                iterator res(next, next_position);
+                if (internal_delete)
+                    ++res;
+                return res;
+            }
+
+            iterator erase(iterator position) { return this->erase(const_iterator(position)); }
+
+            template <typename Key>
+            size_type erase(const Key& key)
+            {
+                iterator iter = this->find(key);
+                if (iter == this->end())
+                    return 0;
+                this->erase(iter);
+                return 1;
+            }
+
+            void erase(const_iterator first, const_iterator last)
+            {
+                if (first == this->begin() && last == this->end())
+                {
+                    this->clear();
+                    return ;
+                }
+                difference_type n = ft::distance(first, last);
+                while (n-- > 0)
+                    first = this->erase(first);
+            }
+
+            void swap(btree& t)
+            {
+                ft::swap(this->_root, t._root);
+                ft::swap(this->_leftmost, t._leftmost);
+                ft::swap(this->_rightmost, t._rightmost);
+                ft::swap(this->_size, t._size);
+                ft::swap(this->_compare, t._compare);
+                ft::swap(this->_value_alloc, t._value_alloc);
+                ft::swap(this->_leaf_alloc, t._leaf_alloc);
+                ft::swap(this->_internal_alloc, t._internal_alloc);
+            }
+
+            template <typename Key>
+            size_type count(const Key& key) const { return this->find(key) != this->end(); }
+
+            template <typename Key>
+            iterator find(const Key& key)
+            {
+                node_ptr node = _root;
+
+                while (node != NULL)
+                {
+                    int i = this->lower_position(node, key);
+                    if (i < node->_count && !this->_compare(key, node->value(i)))
+                        return iterator(node, i);
+                    if (node->_leaf)
+                        break;
+                    node = node->child(i);
+                }
+                return this->end();
+            }
+
+            template <typename Key>
+            const_iterator find(const Key& key) const
+            {
+                return const_cast<btree*>(this)->find(key);
+            }
+
+            void clear()
+            {
+                if (_root != NULL)
+                {
+                    this->destroy(_root);
+                    _root = NULL;
+                    _leftmost = NULL;
+                    _rightmost = NULL;
+                    _size = 0;
+                }
+            }
+
+            template <typename Key>
+            iterator lower_bound(const Key& key)
+            {
+                node_ptr node = _root;
+                iterator pos = this->end();
+
+                while (node != NULL)
+                {
+                    int i = this->lower_position(node, key);
+                    if (i < node->_count)
+                        pos = iterator(node, i);
+                    if (node->_leaf)
+                        break;
+                    node = node->child(i);
+                }
+                return pos;
+            }
+
+            template <typename Key>
+            const_iterator lower_bound(const Key& key) const
+            {
+                return const_cast<btree*>(this)->lower_bound(key);
+            }
+
+            template <typename Key>
+            iterator upper_bound(const Key& key)
+            {
+                node_ptr node = _root;
+                iterator pos = this->end();
+
+                while (node != NULL)
+                {
+                    int i = this->upper_position(node, key);
+                    if (i < node->_count)
+                        pos = iterator(node, i);
+                    if (node->_leaf)
+                        break;
+                    node = node->child(i);
+                }
+                return pos;
+            }
+
+            template <typename Key>
+            const_iterator upper_bound(const Key& key) const
+            {
+                return const_cast<btree*>(this)->upper_bound(key);
+            }
+
+            template <typename Key>
+            ft::pair<iterator,iterator> equal_range(const Key& key)
+            {
+                return ft::make_pair(this->lower_bound(key), this->upper_bound(key));
+            }
+            template <typename Key>
+            ft::pair<const_iterator,const_iterator> equal_range(const Key& key) const
+            {
+                return ft::make_pair(this->lower_bound(key), this->upper_bound(key));
+            }
+
+            value_compare value_comp() const { return this->_compare; }
+            allocator_type get_allocator() const { return this->_value_alloc; }
+
+        private:
+            // 노드 안에서 key보다 작지 않은 첫 값의 위치
+            template <typename Key>
+            int lower_position(const_node_ptr node, const Key& key) const
+            {
+                int first = 0;
+                int len = node->_count;
+
+                while (len > 0)
+                {
+                    int half = len >> 1;
+                    if (this->_compare(node->value(first + half), key))
+                    {
+                        first += half + 1;
+                        len -= half + 1;
+                    }
+                    else
+                        len = half;
+                }
+                return first;
+            }
+
+            // 노드 안에서 key보다 큰 첫 값의 위치
+            template <typename Key>
+            int upper_position(const_node_ptr node, const Key& key) const
+            {
+                int first = 0;
+                int len = node->_count;
+
+                while (len > 0)
+                {
+                    int half = len >> 1;
+                    if (!this->_compare(key, node->value(first + half)))
+                    {
+                        first += half + 1;
+                        len -= half + 1;
+                    }
+                    else
+                        len = half;
+                }
+                return first;
+            }
+
+            // pos 바로 앞에 넣는다. pos가 internal 노드면 바로 앞 값이 있는 leaf의 끝에 넣는다.
+            iterator insert_before(iterator pos, const value_type& val)
+            {
+                node_ptr node = pos.base();
+                int i = pos.position();
+
+                if (!node->_leaf)
+                {
+                    --pos;
+                    node = pos.base();
+                    i = pos.position() + 1;
+                }
+                return this->insert_at(node, i, val);
+            }
+
+            // leaf의 i번 자리에 넣는다. 가득 차 있으면 먼저 나눈다. node가 NULL이면 빈 트리다.
+            iterator insert_at(node_ptr node, int i, const value_type& val)
+            {
+                if (node == NULL)
+                {
+                    node = this->new_node(true);
+                    _root = node;
+                    _leftmost = node;
+                    _rightmost = node;
+                }
+                else if (node->_count == max_count)
+                    this->split(node, i);
+                this->relocate(node->values() + i + 1, node->values() + i, node->_count - i);
+                try
+                {
+                    this->_value_alloc.construct(node->values() + i, val);
+                }
+                catch (...)
+                {
+                    this->relocate(node->values() + i, node->values() + i + 1, node->_count - i);
+                    if (_size == 0)
+                        this->clear_empty_root();
+                    else
+                    {
+                        // 맨 앞(맨 끝)에 넣으려고 나눈 경우 값이 들어갈 leaf가 비어 있으므로 erase처럼 다시 합친다.
+                        node_ptr next = NULL;
+                        int next_position = 0;
+                        this->rebalance_after_erase(node, next, next_position);
+                    }
+                    throw;
+                }
+                ++node->_count;
+                ++this->_size;
+                return iterator(node, i);
+            }
+
+            // 가득 찬 node를 나눠서 오른쪽 절반을 새 형제로 옮기고 가운데 값을 부모로 올린다.
+            // 부모도 가득 차 있으면 부모부터 나눈다. (node, position)은 넣으려던 값이 들어갈 자리로 바뀐다.
+            // 맨 끝(맨 앞)에 넣는 중이면 왼쪽(오른쪽)을 가득 채운 채로 나눠서, 정렬된 입력에서도 노드가 절반만 차지 않게 한다.
+            void split(node_ptr& node, int& position)
+            {
+                node_ptr parent = node->_parent;
+                if (parent == NULL)
+                {
+                    parent = this->new_node(false);
+                    parent->set_child(0, node);
+                    _root = parent;
+                }
+                else if (parent->_count == max_count)
+                {
+                    int parent_position = node->_position;
+                    this->split(parent, parent_position);
+                    parent = node->_parent;
+                }
+
+                int split_count;
+                if (position == 0)
+                    split_count = 0;
+                else if (position == max_count)
+                    split_count = max_count - 1;
+                else
+                    split_count = max_count / 2;
+
+                node_ptr sibling = this->new_node(node->_leaf);
+                int moved = node->_count - split_count - 1;
+                this->relocate(sibling->values(), node->values() + split_count + 1, moved);
+                if (!node->_leaf)
+                {
+                    for (int i = 0; i <= moved; i++)
+                        sibling->set_child(i, node->child(split_count + 1 + i));
+                }
+                sibling->_count = static_cast<unsigned short>(moved);
+
+                int p = node->_position;
+                this->relocate(parent->values() + p + 1, parent->values() + p, parent->_count - p);
+                this->relocate(parent->values() + p, node->values() + split_count, 1);
+                for (int i = parent->_count; i > p; i--)
+                    parent->set_child(i + 1, parent->child(i));
+                parent->set_child(p + 1, sibling);
+                ++parent->_count;
+                node->_count = static_cast<unsigned short>(split_count);
+
+                if (node == _rightmost)
+                    _rightmost = sibling;
+                if (position > split_count)
+                {
+                    node = sibling;
+                    position -= split_count + 1;
+                }
+            }
+
+            // node가 최소 개수보다 적으면 형제와 합치거나 형제의 값을 가져온다. 합치면 부모가 하나 줄어드니 위로 올라가며 반복한다.
+            // (next, next_position)은 erase가 돌려줄 다음 값의 위치로, 값이 옮겨지면 같이 따라간다.
+            void rebalance_after_erase(node_ptr node, node_ptr& next, int& next_position)
+            {
+                while (node != _root && node->_count < min_count)
+                {
+                    node_ptr parent = node->_parent;
+                    int p = node->_position;
+                    node_ptr left = (p > 0) ? parent->child(p - 1) : NULL;
+                    node_ptr right = (p < parent->_count) ? parent->child(p + 1) : NULL;
+
+                    if (left != NULL && left->_count + 1 + node->_count <= max_count)
+                        this->merge(left, node, next, next_position);
+                    else if (right != NULL && node->_count + 1 + right->_count <= max_count)
+                        this->merge(node, right, next, next_position);
+                    else
+                    {
+                        if (left != NULL && (right == NULL || left->_count >= right->_count))
+                            this->move_to_right(left, node, (left->_count - node->_count + 1) / 2, next, next_position);
+                        else
+                            this->move_to_left(node, right, (right->_count - node->_count + 1) / 2);
+                        return ;
+                    }
+                    node = parent;
+                }
+                if (node == _root && _root->_count == 0)
+                {
+                    if (_root->_leaf)
+                    {
+                        this->clear_empty_root();
+                        return ;
+                    }
+                    node_ptr old_root = _root;
+                    _root = old_root->child(0);
+                    _root->_parent = NULL;
+                    _root->_position = 0;
+                    this->delete_node(old_root);
+                }
+            }
+
+            // right를 left 뒤에 붙인다. 둘 사이의 부모 값이 가운데로 내려온다.
+            void merge(node_ptr left, node_ptr right, node_ptr& next, int& next_position)
+            {
+                node_ptr parent = left->_parent;
+                int p = left->_position;
+                int left_count = left->_count;
+
+                this->relocate(left->values() + left_count, parent->values() + p, 1);
+                this->relocate(left->values() + left_count + 1, right->values(), right->_count);
+                if (!left->_leaf)
+                {
+                    for (int i = 0; i <= right->_count; i++)
+                        left->set_child(left_count + 1 + i, right->child(i));
+                }
+                left->_count = static_cast<unsigned short>(left_count + 1 + right->_count);
+
+                this->relocate(parent->values() + p, parent->values() + p + 1, parent->_count - p - 1);
+                for (int i = p + 1; i < parent->_count; i++)
+                    parent->set_child(i, parent->child(i + 1));
+                --parent->_count;
+
+                if (next == right)
+                {
+                    next = left;
+                    next_position += left_count + 1;
+                }
+                if (right == _rightmost)
+                    _rightmost = left;
+                this->delete_node(right);
+            }
+
+            // left의 마지막 n개를 부모를 거쳐 right 앞으로 옮긴다.
+            void move_to_right(node_ptr left, node_ptr right, int n, node_ptr& next, int& next_position)
+            {
+                node_ptr parent = left->_parent;
+                int p = left->_position;
+
+                this->relocate(right->values() + n, right->values(), right->_count);
+                this->relocate(right->values() + n - 1, parent->values() + p, 1);
+                this->relocate(right->values(), left->values() + left->_count - n + 1, n - 1);
+                this->relocate(parent->values() + p, left->values() + left->_count - n, 1);
+                if (!right->_leaf)
+                {
+                    for (int i = right->_count; i >= 0; i--)
+                        right->set_child(i + n, right->child(i));
+                    for (int i = 0; i < n; i++)
+                        right->set_child(i, left->child(left->_count - n + 1 + i));
+                }
+                left->_count = static_cast<unsigned short>(left->_count - n);
+                right->_count = static_cast<unsigned short>(right->_count + n);
+                if (next == right)
+                    next_position += n;
+            }
+
+            // right의 처음 n개를 부모를 거쳐 left 뒤로 옮긴다. (left 안의 위치는 바뀌지 않는다)
+            void move_to_left(node_ptr left, node_ptr right, int n)
+            {
+                node_ptr parent = left->_parent;
+                int p = left->_position;
+
+                this->relocate(left->values() + left->_count, parent->values() + p, 1);
+                this->relocate(left->values() + left->_count + 1, right->values(), n - 1);
+                this->relocate(parent->values() + p, right->values() + n - 1, 1);
+                this->relocate(right->values(), right->values() + n, right->_count - n);
+                if (!left->_leaf)
+                {
+                    for (int i = 0; i < n; i++)
+                        left->set_child(left->_count + 1 + i, right->child(i));
+                    for (int i = 0; i <= right->_count - n; i++)
+                        right->set_child(i, right->child(i + n));
+                }
+                left->_count = static_cast<unsigned short>(left->_count + n);
+                right->_count = static_cast<unsigned short>(right->_count - n);
+            }
+
+            // [src, src + n)의 값을 dst로 옮긴다. 옮긴 뒤 src 쪽은 소멸된 상태가 된다. (vector::relocate와 같다)
+            void relocate(value_type* dst, value_type* src, int n)
+            {
+                this->relocate(dst, src, n, typename ft::is_trivially_relocatable<value_type>::type());
+            }
+
+            void relocate(value_type* dst, value_type* src, int n, ft::true_type)
+            {
+                if (n > 0 && dst != src)
+                    std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            }
+
+            void relocate(value_type* dst, value_type* src, int n, ft::false_type)
+            {
+                if (dst < src)
+                {
+                    for (int i = 0; i < n; i++)
+                    {
+                        this->_value_alloc.construct(dst + i, FT_MOVE_IF_NOEXCEPT(*(src + i)));
+                        this->_value_alloc.destroy(src + i);
+                    }
+                }
+                else if (dst > src)
+                {
+                    while (n-- > 0)
+                    {
+                        this->_value_alloc.construct(dst + n, FT_MOVE_IF_NOEXCEPT(*(src + n)));
+                        this->_value_alloc.destroy(src + n);
+                    }
+                }
+            }
+
+            node_ptr new_node(bool leaf)
+            {
+                node_ptr node;
+                if (leaf)
+                    node = this->_leaf_alloc.allocate(1);
+                else
+                    node = this->_internal_alloc.allocate(1);
+                node->init(leaf);
+                return node;
+            }
+
+            void delete_node(node_ptr node)
+            {
+                if (node->_leaf)
+                    this->_leaf_alloc.deallocate(node, 1);
+                else
+                    this->_internal_alloc.deallocate(static_cast<internal_node_type*>(node), 1);
+            }
+
+            void clear_empty_root()
+            {
+                this->delete_node(_root);
+                _root = NULL;
+                _leftmost = NULL;
+                _rightmost = NULL;
+            }
+
+            void destroy(node_ptr node)
+            {
+                if (!node->_leaf)
+                {
+                    for (int i = 0; i <= node->_count; i++)
+                        this->destroy(node->child(i));
+                }
+                for (int i = 0; i < node->_count; i++)
+                    this->_value_alloc.destroy(node->values() + i);
+                this->delete_node(node);
+            }
+
+            // 모양을 그대로 두고 노드 단위로 복사한다.
+            node_ptr copy(const_node_ptr src)
+            {
+                node_ptr node = this->new_node(src->_leaf);
+                int children = 0;
+                try
+                {
+                    for (int i = 0; i < src->_count; i++)
+                    {
+                        this->_value_alloc.construct(node->values() + i, src->value(i));
+                        node->_count = static_cast<unsigned short>(i + 1);
+                    }
+                    if (!src->_leaf)
+                    {
+                        for (; children <= src->_count; children++)
+                            node->set_child(children, this->copy(src->child(children)));
+                    }
+                }
+                catch (...)
+                {
+                    for (int i = 0; i < children; i++)
+                        this->destroy(node->child(i));
+                    for (int i = 0; i < node->_count; i++)
+                        this->_value_alloc.destroy(node->values() + i);
+                    this->delete_node(node);
+                    throw;
+                }
+                return node;
+            }
+
+            void copy_from(const btree& obj)
+            {
+                if (obj._root == NULL)
+                    return ;
+                _root = this->copy(obj._root);
+                _size = obj._size;
+                _leftmost = _root;
+                while (!_leftmost->_leaf)
+                    _leftmost = _leftmost->child(0);
+                _rightmost = _root;
+                while (!_rightmost->_leaf)
+                    _rightmost = _rightmost->child(_rightmost->_count);
+            }
+    };
+}
+
+#endif
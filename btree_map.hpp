@@ -0,0 +1,208 @@
+#ifndef BTREE_MAP_HPP
+#define BTREE_MAP_HPP
+
+#include "btree.hpp"
+
+namespace ft
+{
+    // map과 같은 인터페이스를 가진 B-tree 기반 map. (btree.hpp)
+    // 노드 하나에 값 여러 개가 붙어 있어서 키가 많을 때 find/순회의 cache miss가 map보다 훨씬 적다.
+    // 대신 insert/erase를 하면 기존 iterator와 값의 주소가 모두 무효가 된다.
+    template <typename Key, typename T, typename Compare = std::less<Key>, typename Alloc = std::allocator<ft::pair<const Key, T> > >
+    class btree_map
+    {
+        public:
+            typedef Key                                                                 key_type;
+            typedef T                                                                   mapped_type;
+            typedef ft::pair<const key_type, mapped_type>                               value_type;
+            typedef Compare                                                             key_compare;
+            typedef Alloc                                                               allocator_type;
+            typedef typename allocator_type::reference                                  reference;
+            typedef typename allocator_type::const_reference                            const_reference;
+            typedef typename allocator_type::pointer                                    pointer;
+            typedef typename allocator_type::const_pointer                              const_pointer;
+            typedef typename std::ptrdiff_t                                             difference_type;
+            typedef typename std::size_t                                                size_type;
+            class value_compare
+            {
+                friend class		btree_map;
+            
+                protected :
+                    key_compare			comp;
+                    value_compare(key_compare c) : comp(c) {}
+                public:
+                    typedef bool result_type;
+                    typedef value_type first_argument_type;
+                    typedef value_type second_argument_type;
+                    bool operator()(const value_type& x, const value_type& y) const
+                    { return comp(x.first, y.first); }
+
+                    // key만으로 검색할 때는 value를 만들지 않고 key와 바로 비교한다.
+                    bool operator()(const value_type& x, const key_type& k) const
+                    { return comp(x.first, k); }
+                    bool operator()(const key_type& k, const value_type& y) const
+                    { return comp(k, y.first); }
+
+                    // range insert로 들어온 다른 pair 타입(ft::pair<Key, T> 등)도 value_type으로 바꾸지 않고 비교한다.
+                    template <typename U1, typename V1, typename U2, typename V2>
+                    bool operator()(const ft::pair<U1, V1>& x, const ft::pair<U2, V2>& y) const
+                    { return comp(x.first, y.first); }
+
+                    // key_compare가 transparent면 key_type이 아닌 타입으로도 검색할 수 있다.
+                    template <typename K>
+                    typename ft::enable_if<ft::is_transparent<key_compare>::value && !ft::is_pair<K>::value, bool>::type
+                    operator()(const value_type& x, const K& k) const
+                    { return comp(x.first, k); }
+                    template <typename K>
+                    typename ft::enable_if<ft::is_transparent<key_compare>::value && !ft::is_pair<K>::value, bool>::type
+                    operator()(const K& k, const value_type& y) const
+                    { return comp(k, y.first); }
+            };
+            typedef typename ft::btree<value_type, value_compare, allocator_type>       tree_type;
+            typedef typename tree_type::iterator                                        iterator;
+			typedef typename tree_type::const_iterator                                  const_iterator;
+			typedef typename tree_type::reverse_iterator		                        reverse_iterator;
+		    typedef typename tree_type::const_reverse_iterator	                        const_reverse_iterator;	
+        private:
+            tree_type		_tree;
+        public:
+            // (1) empty container constructor (default constructor)
+            // Constructs an empty container, with no elements.
+            explicit btree_map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _tree(comp, alloc) {}
+
+            // (2) range constructor
+            // Constructs a container with as many elements as the range [first,last), with each element constructed from its corresponding element in that range.
+            template <class InputIterator>
+            btree_map (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _tree(comp, alloc)
+            {
+                this->insert(first, last);
+            }
+
+            // (3) copy constructor
+            // Constructs a container with a copy of each of the elements in x.
+            btree_map (const btree_map& x): _tree(x._tree) {}
+
+            ~btree_map() {}
+
+            btree_map& operator= (const btree_map& x)
+            {
+                if (this != &x)
+                    _tree = x._tree;
+                return (*this);
+            }
+#if __cplusplus >= 201103L
+            btree_map (btree_map&& x): _tree(std::move(x._tree)) {}
+            btree_map& operator= (btree_map&& x)
+            {
+                _tree = std::move(x._tree);
+                return (*this);
+            }
+#endif
+
+            // ============================================Iterators============================================
+            iterator begin() { return (_tree.begin()); }
+            const_iterator begin() const { return (_tree.begin()); }
+            iterator end() { return (_tree.end()); }
+            const_iterator end() const { return (_tree.end()); }
+            reverse_iterator rbegin() { return (_tree.rbegin()); }
+            const_reverse_iterator rbegin() const { return (_tree.rbegin()); }
+            reverse_iterator rend() { return (_tree.rend()); }
+            const_reverse_iterator rend() const { return (_tree.rend()); }
+
+            // =============================================Capacity=============================================
+            bool empty() const { return (_tree.empty()); }
+            size_type size() const { return (_tree.size()); }
+            size_type max_size() const { return (_tree.max_size()); }
+
+            // ===========================================Element access===========================================
+            // 이미 있는 key라면 mapped_type을 만들지 않는다.
+            // 없을 때는 lower_bound 위치가 새 노드 자리이므로 hint로 넘겨서 다시 내려가지 않게 한다.
+            mapped_type& operator[](const key_type& k) 
+            {
+                iterator it = this->lower_bound(k);
+                if (it == this->end() || _tree.value_comp()(k, *it))
+                    it = _tree.insert(it, value_type(k, mapped_type()));
+                return (*it).second;
+            }
+
+            // =============================================Modifiers=============================================
+            ft::pair<iterator, bool> insert(const value_type& x) { return (_tree.insert(x)); }
+            iterator insert(iterator position, const value_type& x) { return (_tree.insert(position, x)); }
+            template <typename InputIterator>
+            void insert(InputIterator first, InputIterator last) { return (_tree.insert(first, last)); }
+            // 값이 노드 사이를 옮겨 다니므로 erase 뒤에는 다른 iterator가 모두 무효가 된다. 대신 다음 값의 iterator를 돌려준다.
+            iterator erase(iterator position) { return (_tree.erase(position)); }
+            size_type erase(const key_type& x) { return (_tree.erase(x)); }
+            void erase(iterator first, iterator last) { _tree.erase(first, last); }
+            void swap(btree_map& x) { _tree.swap(x._tree); }
+            void clear() { _tree.clear(); }
+
+            // =============================================Observers=============================================
+            key_compare key_comp() const { return (_tree.value_comp().comp); }
+            value_compare value_comp() const { return (_tree.value_comp()); }
+
+            // =============================================Operations=============================================
+            iterator find(const key_type& x) { return (_tree.find(x)); }
+            const_iterator find(const key_type& x) const { return (_tree.find(x)); }
+            size_type count(const key_type& x) const { return (_tree.count(x)); }
+            iterator lower_bound(const key_type& x) { return (_tree.lower_bound(x)); }
+            const_iterator lower_bound(const key_type& x) const { return (_tree.lower_bound(x)); }
+            iterator upper_bound(const key_type& x) { return (_tree.upper_bound(x)); }
+            const_iterator upper_bound(const key_type& x) const { return (_tree.upper_bound(x)); }
+            ft::pair<iterator,iterator> equal_range(const key_type& x) { return (_tree.equal_range(x)); }
+            ft::pair<const_iterator,const_iterator> equal_range(const key_type& x) const { return (_tree.equal_range(x)); }
+
+            // transparent comparator(ft::less<> 등)일 때만 쓸 수 있는 key_type 이외의 타입으로 검색하는 overload
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type find(const K& x) { return (_tree.find(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type find(const K& x) const { return (_tree.find(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, size_type>::type count(const K& x) const { return (_tree.count(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type lower_bound(const K& x) { return (_tree.lower_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type lower_bound(const K& x) const { return (_tree.lower_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type upper_bound(const K& x) { return (_tree.upper_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type upper_bound(const K& x) const { return (_tree.upper_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, ft::pair<iterator, iterator> >::type equal_range(const K& x) { return (_tree.equal_range(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, ft::pair<const_iterator, const_iterator> >::type equal_range(const K& x) const { return (_tree.equal_range(x)); }
+
+            // =============================================Allocator=============================================
+            allocator_type get_allocator() const { return _tree.get_allocator(); }
+    };
+
+    template <class Key_, class T_, class Compare_, class Alloc>
+	bool operator==(const ft::btree_map<Key_,T_,Compare_,Alloc>& x, const ft::btree_map<Key_,T_,Compare_,Alloc>& y)
+	{
+		if (x.size() != y.size())
+			return (false);
+		return (ft::equal(x.begin(), x.end(), y.begin()));
+	}
+    template <class Key_, class T_, class Compare_, class Alloc>
+	bool operator!=(const btree_map<Key_,T_,Compare_,Alloc>& x, const btree_map<Key_,T_,Compare_,Alloc>& y) { return (!(x == y)); }
+
+	template <class Key_, class T_, class Compare_, class Alloc>
+	bool operator< (const btree_map<Key_,T_,Compare_,Alloc>& x, const btree_map<Key_,T_,Compare_,Alloc>& y)
+	{
+		return (ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()));
+	}
+
+	template <class Key_, class T_, class Compare_, class Alloc>
+	bool operator> (const btree_map<Key_,T_,Compare_,Alloc>& x, const btree_map<Key_,T_,Compare_,Alloc>& y) { return (y < x); }
+
+	template <class Key_, class T_, class Compare_, class Alloc>
+	bool operator>=(const btree_map<Key_,T_,Compare_,Alloc>& x, const btree_map<Key_,T_,Compare_,Alloc>& y) { return !(x < y); }
+
+	template <class Key_, class T_, class Compare_, class Alloc>
+	bool operator<=(const btree_map<Key_,T_,Compare_,Alloc>& x, const btree_map<Key_,T_,Compare_,Alloc>& y) { return !(y < x); }
+
+    template <class Key_, class T_, class Compare_, class Alloc>
+    void swap(ft::btree_map<Key_, T_, Compare_, Alloc>& x, ft::btree_map<Key_, T_, Compare_, Alloc>& y) { x.swap(y); }
+}
+
+#endif
\ No newline at end of file
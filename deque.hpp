@@ -0,0 +1,783 @@
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <cstring>
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "iterator_base.hpp"
+#include "reverse_iterator.hpp"
+
+// block 하나의 목표 크기(byte). 원소가 커도 block 하나에 최소 16개는 들어간다.
+#ifndef FT_DEQUE_BLOCK_BYTES
+# define FT_DEQUE_BLOCK_BYTES 4096
+#endif
+
+namespace ft
+{
+    // =========================================deque block size=========================================
+    template <typename T>
+    struct deque_block_size
+    {
+        static const std::size_t value = (sizeof(T) < FT_DEQUE_BLOCK_BYTES / 16) ? FT_DEQUE_BLOCK_BYTES / sizeof(T) : 16;
+    };
+
+    // ============================================Iterators============================================
+    // deque의 원소는 같은 크기의 block 여러 개에 나뉘어 있고, block 포인터들은 map 배열에 순서대로 있다.
+    // iterator는 지금 원소(_cur), 그 block의 처음과 끝(_first, _last), map에서 block의 자리(_node)를 가진다.
+    // block 안에서는 포인터처럼 움직이고, block 끝을 넘을 때만 map을 따라 다음 block으로 간다.
+    template <typename T, typename Ref, typename Ptr>
+    class deque_iterator : public ft::iterator<ft::random_access_iterator_tag, T, std::ptrdiff_t, Ptr, Ref>
+    {
+        public:
+            typedef deque_iterator<T, T&, T*>               iterator;
+            typedef deque_iterator<T, const T&, const T*>   const_iterator;
+            typedef T                                       value_type;
+            typedef Ptr                                     pointer;
+            typedef Ref                                     reference;
+            typedef std::ptrdiff_t                          difference_type;
+            typedef T*                                      elt_pointer;
+            typedef T**                                     map_pointer;
+
+            static difference_type block_size() { return static_cast<difference_type>(deque_block_size<T>::value); }
+
+            elt_pointer _cur;
+            elt_pointer _first;
+            elt_pointer _last;
+            map_pointer _node;
+
+            deque_iterator(): _cur(), _first(), _last(), _node() {}
+            deque_iterator(elt_pointer cur, map_pointer node): _cur(cur), _first(*node), _last(*node + block_size()), _node(node) {}
+            // iterator -> const_iterator (T&일 때는 복사 생성자)
+            deque_iterator(const iterator& x): _cur(x._cur), _first(x._first), _last(x._last), _node(x._node) {}
+            deque_iterator& operator=(const deque_iterator& x)
+            {
+                _cur = x._cur;
+                _first = x._first;
+                _last = x._last;
+                _node = x._node;
+                return *this;
+            }
+
+            reference operator*() const { return *_cur; }
+            pointer operator->() const { return _cur; }
+            deque_iterator& operator++()
+            {
+                if (++_cur == _last)
+                {
+                    this->set_node(_node + 1);
+                    _cur = _first;
+                }
+                return *this;
+            }
+            deque_iterator operator++(int)
+            {
+                deque_iterator rtn(*this);
+                ++(*this);
+                return rtn;
+            }
+            deque_iterator& operator--()
+            {
+                if (_cur == _first)
+                {
+                    this->set_node(_node - 1);
+                    _cur = _last;
+                }
+                --_cur;
+                return *this;
+            }
+            deque_iterator operator--(int)
+            {
+                deque_iterator rtn(*this);
+                --(*this);
+                return rtn;
+            }
+            deque_iterator& operator+=(difference_type n)
+            {
+                difference_type offset = n + (_cur - _first);
+                if (offset >= 0 && offset < block_size())
+                    _cur += n;
+                else
+                {
+                    difference_type node_offset = offset > 0 ? offset / block_size() : -((-offset - 1) / block_size()) - 1;
+                    this->set_node(_node + node_offset);
+                    _cur = _first + (offset - node_offset * block_size());
+                }
+                return *this;
+            }
+            deque_iterator operator+(difference_type n) const
+            {
+                deque_iterator rtn(*this);
+                return rtn += n;
+            }
+            deque_iterator& operator-=(difference_type n) { return *this += -n; }
+            deque_iterator operator-(difference_type n) const
+            {
+                deque_iterator rtn(*this);
+                return rtn -= n;
+            }
+            reference operator[](difference_type n) const { return *(*this + n); }
+
+            // 같은 deque 안의 두 iterator 사이의 원소 수. end()는 마지막 block의 _first일 수도 있으므로 _node로 센다.
+            template <typename R, typename P>
+            difference_type operator-(const deque_iterator<T, R, P>& x) const
+            {
+                if (_node == x._node)
+                    return _cur - x._cur;
+                return block_size() * (_node - x._node - 1) + (_cur - _first) + (x._last - x._cur);
+            }
+
+            void set_node(map_pointer node)
+            {
+                _node = node;
+                _first = *node;
+                _last = _first + block_size();
+            }
+    };
+
+    template <typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+    inline bool operator==(const deque_iterator<T, RefL, PtrL>& lhs, const deque_iterator<T, RefR, PtrR>& rhs)
+    { return lhs._cur == rhs._cur; }
+
+    template <typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+    inline bool operator!=(const deque_iterator<T, RefL, PtrL>& lhs, const deque_iterator<T, RefR, PtrR>& rhs)
+    { return lhs._cur != rhs._cur; }
+
+    template <typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+    inline bool operator<(const deque_iterator<T, RefL, PtrL>& lhs, const deque_iterator<T, RefR, PtrR>& rhs)
+    { return (lhs._node == rhs._node) ? lhs._cur < rhs._cur : lhs._node < rhs._node; }
+
+    template <typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+    inline bool operator>(const deque_iterator<T, RefL, PtrL>& lhs, const deque_iterator<T, RefR, PtrR>& rhs)
+    { return rhs < lhs; }
+
+    template <typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+    inline bool operator<=(const deque_iterator<T, RefL, PtrL>& lhs, const deque_iterator<T, RefR, PtrR>& rhs)
+    { return !(rhs < lhs); }
+
+    template <typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+    inline bool operator>=(const deque_iterator<T, RefL, PtrL>& lhs, const deque_iterator<T, RefR, PtrR>& rhs)
+    { return !(lhs < rhs); }
+
+    template <typename T, typename Ref, typename Ptr>
+    inline deque_iterator<T, Ref, Ptr> operator+(std::ptrdiff_t n, const deque_iterator<T, Ref, Ptr>& it)
+    { return it + n; }
+
+    // ==============================================Deque==============================================
+    // 같은 크기의 block들과 block 포인터를 담은 map으로 이루어진 deque.
+    // 양 끝의 push/pop은 O(1)이고, 커질 때는 block을 하나 더 할당하거나 map(포인터 배열)만 다시 만든다.
+    // 이미 있는 원소는 옮기지 않으므로 원소 주소가 바뀌지 않고, 큰 원소도 복사하지 않는다.
+    // 중간의 insert/erase는 가까운 쪽 끝의 원소들을 밀어서 처리한다.
+    template <typename T, typename Allocator = std::allocator<T> >
+    class deque
+    {
+        public:
+            typedef T                                                               value_type;
+            typedef Allocator                                                       allocator_type;
+            typedef typename allocator_type::reference                              reference;
+            typedef typename allocator_type::const_reference                        const_reference;
+            typedef typename allocator_type::pointer                                pointer;
+            typedef typename allocator_type::const_pointer                          const_pointer;
+            typedef ft::deque_iterator<T, T&, T*>                                   iterator;
+            typedef ft::deque_iterator<T, const T&, const T*>                       const_iterator;
+            typedef typename ft::reverse_iterator<iterator>                         reverse_iterator;
+            typedef typename ft::reverse_iterator<const_iterator>                   const_reverse_iterator;
+            typedef std::ptrdiff_t                                                  difference_type;
+            typedef std::size_t                                                     size_type;
+
+        private:
+            typedef typename allocator_type::template rebind<pointer>::other        map_alloc_type;
+            typedef pointer*                                                        map_pointer;
+
+            static const size_type  block_size = deque_block_size<T>::value;
+            static const size_type  initial_map_size = 8;
+
+            allocator_type  _alloc;
+            map_alloc_type  _map_alloc;
+            map_pointer     _map;
+            size_type       _map_size;
+            iterator        _start;
+            iterator        _finish;    // _finish._cur는 항상 할당된 block 안에 있다.
+
+        public:
+            // (1) empty container constructor (default constructor)
+            // Constructs an empty container, with no elements.
+            explicit deque (const allocator_type& alloc = allocator_type()): _alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0)
+            {
+                this->initialize_map(0);
+            }
+
+            // (2) fill constructor
+            // Constructs a container with n elements. Each element is a copy of val.
+            explicit deque (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type())
+                : _alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0)
+            {
+                this->initialize_map(0);
+                this->insert(this->end(), n, val);
+            }
+
+            // (3) range constructor
+            // Constructs a container with as many elements as the range [first,last), with each element constructed from its corresponding element in that range, in the same order.
+            template <class InputIterator>
+            deque (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+                        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
+                : _alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0)
+            {
+                this->initialize_map(0);
+                for (; first != last; ++first)
+                    this->push_back(*first);
+            }
+
+            // (4) copy constructor
+            // Constructs a container with a copy of each of the elements in x, in the same order.
+            deque (const deque& x): _alloc(x._alloc), _map_alloc(x._map_alloc), _map(NULL), _map_size(0)
+            {
+                this->initialize_map(0);
+                for (const_iterator it = x.begin(); it != x.end(); ++it)
+                    this->push_back(*it);
+            }
+
+            // This destroys all container elements, and deallocates all the storage allocated by the deque using its allocator.
+            ~deque()
+            {
+                this->clear();
+                this->deallocate_block(*_start._node);
+                _map_alloc.deallocate(_map, _map_size);
+            }
+
+            // Assigns new contents to the container, replacing its current contents, and modifying its size accordingly.
+            deque& operator= (const deque& x)
+            {
+                if (this != &x)
+                    this->assign(x.begin(), x.end());
+                return *this;
+            }
+
+#if __cplusplus >= 201103L
+            // (5) move constructor (C++11)
+            // 원소와 block은 움직이지 않고 빈 deque와 map을 바꾼다.
+            deque (deque&& x): _alloc(x._alloc), _map_alloc(x._map_alloc), _map(NULL), _map_size(0)
+            {
+                this->initialize_map(0);
+                this->swap(x);
+            }
+
+            deque& operator= (deque&& x)
+            {
+                if (this != &x)
+                {
+                    deque tmp(std::move(x));
+                    this->swap(tmp);
+                }
+                return *this;
+            }
+#endif
+
+            // ============================================Iterators============================================
+            iterator begin() { return _start; }
+            const_iterator begin() const { return _start; }
+            iterator end() { return _finish; }
+            const_iterator end() const { return _finish; }
+            reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+            const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+            reverse_iterator rend() { return reverse_iterator(this->begin()); }
+            const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+            // =============================================Capacity=============================================
+            size_type size() const { return _finish - _start; }
+            size_type max_size() const { return _alloc.max_size(); }
+            bool empty() const { return _finish == _start; }
+
+            // Resizes the container so that it contains n elements.
+            void resize (size_type n, value_type val = value_type())
+            {
+                size_type len = this->size();
+                if (n < len)
+                    this->erase(this->begin() + n, this->end());
+                else
+                    this->insert(this->end(), n - len, val);
+            }
+
+            // ===========================================Element access===========================================
+            reference operator[] (size_type n) { return _start[n]; }
+            const_reference operator[] (size_type n) const { return _start[n]; }
+            reference at (size_type n)
+            {
+                if (n >= this->size())
+                    throw std::out_of_range("ft::deque");
+                return _start[n];
+            }
+            const_reference at (size_type n) const
+            {
+                if (n >= this->size())
+                    throw std::out_of_range("ft::deque");
+                return _start[n];
+            }
+            reference front() { return *_start; }
+            const_reference front() const { return *_start; }
+            reference back() { iterator tmp = _finish; --tmp; return *tmp; }
+            const_reference back() const { const_iterator tmp = _finish; --tmp; return *tmp; }
+
+            // ===========================================Modifiers===========================================
+            template <class InputIterator>
+            void assign (InputIterator first, InputIterator last,
+                            typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
+            {
+                this->clear();
+                for (; first != last; ++first)
+                    this->push_back(*first);
+            }
+
+            void assign (size_type n, const value_type& val)
+            {
+                value_type copy(val);
+                this->clear();
+                this->insert(this->end(), n, copy);
+            }
+
+            // 마지막 block에 자리가 없을 때만 block을 새로 할당한다. 기존 원소는 움직이지 않는다.
+            void push_back (const value_type& val)
+            {
+                if (_finish._cur != _finish._last - 1)
+                {
+                    _alloc.construct(_finish._cur, val);
+                    ++_finish._cur;
+                }
+                else
+                    this->push_back_aux(val);
+            }
+
+#if __cplusplus >= 201103L
+            void push_back (value_type&& val) { this->emplace_back(std::move(val)); }
+
+            // Inserts a new element at the end of the deque, constructed in place using args as the arguments for its constructor.
+            template <typename... Args>
+            void emplace_back (Args&&... args)
+            {
+                if (_finish._cur != _finish._last - 1)
+                {
+                    _alloc.construct(_finish._cur, std::forward<Args>(args)...);
+                    ++_finish._cur;
+                }
+                else
+                    this->push_back_aux(std::forward<Args>(args)...);
+            }
+#endif
+
+            void push_front (const value_type& val)
+            {
+                if (_start._cur != _start._first)
+                {
+                    _alloc.construct(_start._cur - 1, val);
+                    --_start._cur;
+                }
+                else
+                    this->push_front_aux(val);
+            }
+
+#if __cplusplus >= 201103L
+            void push_front (value_type&& val) { this->emplace_front(std::move(val)); }
+
+            // Inserts a new element at the beginning of the deque, constructed in place using args as the arguments for its constructor.
+            template <typename... Args>
+            void emplace_front (Args&&... args)
+            {
+                if (_start._cur != _start._first)
+                {
+                    _alloc.construct(_start._cur - 1, std::forward<Args>(args)...);
+                    --_start._cur;
+                }
+                else
+                    this->push_front_aux(std::forward<Args>(args)...);
+            }
+#endif
+
+            // 비게 된 block은 바로 돌려준다.
+            void pop_back()
+            {
+                if (_finish._cur != _finish._first)
+                {
+                    --_finish._cur;
+                    _alloc.destroy(_finish._cur);
+                }
+                else
+                {
+                    this->deallocate_block(_finish._first);
+                    _finish.set_node(_finish._node - 1);
+                    _finish._cur = _finish._last - 1;
+                    _alloc.destroy(_finish._cur);
+                }
+            }
+
+            void pop_front()
+            {
+                if (_start._cur != _start._last - 1)
+                {
+                    _alloc.destroy(_start._cur);
+                    ++_start._cur;
+                }
+                else
+                {
+                    _alloc.destroy(_start._cur);
+                    this->deallocate_block(_start._first);
+                    _start.set_node(_start._node + 1);
+                    _start._cur = _start._first;
+                }
+            }
+
+            // single element (1)
+            iterator insert (iterator position, const value_type& val)
+            {
+                size_type index = position - this->begin();
+                this->insert(position, 1, val);
+                return this->begin() + index;
+            }
+
+#if __cplusplus >= 201103L
+            // 가까운 쪽 끝에 원소를 하나 옮겨 만들고, 그 사이 원소들을 한 칸씩 move 대입으로 민다.
+            iterator insert (iterator position, value_type&& val)
+            {
+                size_type index = position - this->begin();
+                size_type len = this->size();
+                if (index == 0)
+                {
+                    this->emplace_front(std::move(val));
+                    return this->begin();
+                }
+                if (index == len)
+                {
+                    this->emplace_back(std::move(val));
+                    return this->begin() + index;
+                }
+                // val이 이 deque의 원소일 수도 있으므로 밀기 전에 꺼내 둔다.
+                value_type tmp(std::move(val));
+                if (index < len / 2)
+                {
+                    this->emplace_front(std::move(this->front()));
+                    iterator dest = this->begin() + 1;
+                    for (iterator it = dest + 1; it != this->begin() + index + 1; ++it, ++dest)
+                        *dest = std::move(*it);
+                }
+                else
+                {
+                    this->emplace_back(std::move(this->back()));
+                    iterator dest = this->begin() + len;
+                    for (iterator it = dest - 1; dest != this->begin() + index + 1; )
+                        *--dest = std::move(*--it);
+                }
+                *(this->begin() + index) = std::move(tmp);
+                return this->begin() + index;
+            }
+#endif
+
+            // fill (2)
+            // 앞쪽이 가까우면 앞에 n개를 더 만들고 position 앞의 원소들을 앞으로 당긴다. 뒤쪽도 같은 방법
+            void insert (iterator position, size_type n, const value_type& val)
+            {
+                if (n == 0)
+                    return ;
+                if (this->max_size() - this->size() < n)
+                    throw std::length_error("deque::insert");
+                value_type copy(val);
+                size_type index = position - this->begin();
+                size_type len = this->size();
+
+                if (index < len / 2)
+                {
+                    for (size_type i = 0; i < n; i++)
+                        this->push_front(copy);
+                    this->copy_forward(this->begin() + n, this->begin() + n + index, this->begin());
+                    this->fill(this->begin() + index, this->begin() + index + n, copy);
+                }
+                else
+                {
+                    for (size_type i = 0; i < n; i++)
+                        this->push_back(copy);
+                    this->copy_backward(this->begin() + index, this->begin() + len, this->begin() + len + n);
+                    this->fill(this->begin() + index, this->begin() + index + n, copy);
+                }
+            }
+
+            // range (3)
+            // 범위가 이 deque를 가리킬 수도 있으므로 먼저 복사해 둔다.
+            template <class InputIterator>
+            void insert (iterator position, InputIterator first, InputIterator last,
+                            typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+            {
+                deque values(first, last, _alloc);
+                size_type n = values.size();
+                if (n == 0)
+                    return ;
+                size_type index = position - this->begin();
+                size_type len = this->size();
+
+                if (index < len / 2)
+                {
+                    for (size_type i = 0; i < n; i++)
+                        this->push_front(values[n - 1 - i]);
+                    this->copy_forward(this->begin() + n, this->begin() + n + index, this->begin());
+                    this->copy_forward(values.begin(), values.end(), this->begin() + index);
+                }
+                else
+                {
+                    for (size_type i = 0; i < n; i++)
+                        this->push_back(values[i]);
+                    this->copy_backward(this->begin() + index, this->begin() + len, this->begin() + len + n);
+                    this->copy_forward(values.begin(), values.end(), this->begin() + index);
+                }
+            }
+
+            // Removes from the deque either a single element (position) or a range of elements ([first,last)).
+            // 가까운 쪽 끝의 원소들을 빈 자리로 밀고 끝에서 지운다.
+            iterator erase (iterator position)
+            {
+                iterator next = position;
+                ++next;
+                return this->erase(position, next);
+            }
+
+            iterator erase (iterator first, iterator last)
+            {
+                if (first == this->begin() && last == this->end())
+                {
+                    this->clear();
+                    return this->end();
+                }
+                size_type n = last - first;
+                size_type index = first - this->begin();
+
+                if (index < (this->size() - n) / 2)
+                {
+                    this->copy_backward(this->begin(), first, last);
+                    for (size_type i = 0; i < n; i++)
+                        this->pop_front();
+                }
+                else
+                {
+                    this->copy_forward(last, this->end(), first);
+                    for (size_type i = 0; i < n; i++)
+                        this->pop_back();
+                }
+                return this->begin() + index;
+            }
+
+            // Exchanges the content of the container by the content of x. 원소는 움직이지 않고 map만 바꾼다.
+            void swap (deque& x)
+            {
+                if (&x == this)
+                    return ;
+                ft::swap(this->_map, x._map);
+                ft::swap(this->_map_size, x._map_size);
+                ft::swap(this->_start, x._start);
+                ft::swap(this->_finish, x._finish);
+                ft::swap(this->_alloc, x._alloc);
+                ft::swap(this->_map_alloc, x._map_alloc);
+            }
+
+            // Removes all elements from the deque (which are destroyed), leaving the container with a size of 0.
+            // 처음 block 하나만 남기고 모두 돌려준다.
+            void clear()
+            {
+                for (iterator it = _start; it != _finish; ++it)
+                    _alloc.destroy(it._cur);
+                for (map_pointer node = _start._node + 1; node <= _finish._node; ++node)
+                    this->deallocate_block(*node);
+                _finish = _start;
+            }
+
+            // Destroys at most budget elements from the back. Returns true once the deque is empty.
+            // pop_back처럼 비는 block은 바로 돌려준다. (처음 block 하나는 clear처럼 남는다)
+            bool clear_some(size_type budget)
+            {
+                for (; budget > 0 && !this->empty(); budget--)
+                    this->pop_back();
+                return this->empty();
+            }
+
+            // ===========================================Allocator===========================================
+            allocator_type get_allocator() const { return _alloc; }
+
+        private:
+            pointer allocate_block() { return _alloc.allocate(block_size); }
+            void deallocate_block(pointer block) { _alloc.deallocate(block, block_size); }
+
+            // n개가 들어갈 만큼 block을 만들고 map 가운데에 둔다. 양쪽으로 자랄 자리를 남기기 위해서다.
+            void initialize_map(size_type n)
+            {
+                size_type nodes = n / block_size + 1;
+                _map_size = (nodes + 2 > initial_map_size) ? nodes + 2 : initial_map_size;
+                _map = _map_alloc.allocate(_map_size);
+
+                map_pointer nstart = _map + (_map_size - nodes) / 2;
+                map_pointer nfinish = nstart + nodes;
+                map_pointer cur = nstart;
+                try
+                {
+                    for (; cur < nfinish; ++cur)
+                        *cur = this->allocate_block();
+                }
+                catch (...)
+                {
+                    while (cur != nstart)
+                        this->deallocate_block(*--cur);
+                    _map_alloc.deallocate(_map, _map_size);
+                    _map = NULL;
+                    _map_size = 0;
+                    throw;
+                }
+                _start.set_node(nstart);
+                _finish.set_node(nfinish - 1);
+                _start._cur = _start._first;
+                _finish._cur = _finish._first + n % block_size;
+            }
+
+#if __cplusplus >= 201103L
+            template <typename... Args>
+            void push_back_aux(Args&&... args)
+            {
+                this->reserve_map_at_back(1);
+                *(_finish._node + 1) = this->allocate_block();
+                try
+                {
+                    _alloc.construct(_finish._cur, std::forward<Args>(args)...);
+                }
+#else
+            void push_back_aux(const value_type& val)
+            {
+                this->reserve_map_at_back(1);
+                *(_finish._node + 1) = this->allocate_block();
+                try
+                {
+                    _alloc.construct(_finish._cur, val);
+                }
+#endif
+                catch (...)
+                {
+                    this->deallocate_block(*(_finish._node + 1));
+                    throw;
+                }
+                _finish.set_node(_finish._node + 1);
+                _finish._cur = _finish._first;
+            }
+
+#if __cplusplus >= 201103L
+            template <typename... Args>
+            void push_front_aux(Args&&... args)
+            {
+                this->reserve_map_at_front(1);
+                *(_start._node - 1) = this->allocate_block();
+                try
+                {
+                    _alloc.construct(*(_start._node - 1) + block_size - 1, std::forward<Args>(args)...);
+                }
+#else
+            void push_front_aux(const value_type& val)
+            {
+                this->reserve_map_at_front(1);
+                *(_start._node - 1) = this->allocate_block();
+                try
+                {
+                    _alloc.construct(*(_start._node - 1) + block_size - 1, val);
+                }
+#endif
+                catch (...)
+                {
+                    this->deallocate_block(*(_start._node - 1));
+                    throw;
+                }
+                _start.set_node(_start._node - 1);
+                _start._cur = _start._last - 1;
+            }
+
+            void reserve_map_at_back(size_type nodes_to_add)
+            {
+                if (nodes_to_add + 1 > _map_size - (_finish._node - _map))
+                    this->reallocate_map(nodes_to_add, false);
+            }
+
+            void reserve_map_at_front(size_type nodes_to_add)
+            {
+                if (nodes_to_add > static_cast<size_type>(_start._node - _map))
+                    this->reallocate_map(nodes_to_add, true);
+            }
+
+            // map이 한쪽 끝에 닿았을 때: 전체 자리가 넉넉하면 block 포인터들을 가운데로 옮기고, 아니면 map을 키운다.
+            // 옮기는 것은 block 포인터뿐이고 원소는 그대로다.
+            void reallocate_map(size_type nodes_to_add, bool add_at_front)
+            {
+                size_type old_nodes = _finish._node - _start._node + 1;
+                size_type new_nodes = old_nodes + nodes_to_add;
+                map_pointer new_start;
+
+                if (_map_size > 2 * new_nodes)
+                {
+                    new_start = _map + (_map_size - new_nodes) / 2 + (add_at_front ? nodes_to_add : 0);
+                    std::memmove(new_start, _start._node, old_nodes * sizeof(pointer));
+                }
+                else
+                {
+                    size_type new_map_size = _map_size + (_map_size > nodes_to_add ? _map_size : nodes_to_add) + 2;
+                    map_pointer new_map = _map_alloc.allocate(new_map_size);
+                    new_start = new_map + (new_map_size - new_nodes) / 2 + (add_at_front ? nodes_to_add : 0);
+                    std::memcpy(new_start, _start._node, old_nodes * sizeof(pointer));
+                    _map_alloc.deallocate(_map, _map_size);
+                    _map = new_map;
+                    _map_size = new_map_size;
+                }
+                _start.set_node(new_start);
+                _finish.set_node(new_start + old_nodes - 1);
+            }
+
+            // 원소를 대입으로 옮긴다. copy_forward는 dest가 앞쪽일 때, copy_backward는 뒤쪽일 때 겹쳐도 된다.
+            template <typename Iterator>
+            static void copy_forward(Iterator first, Iterator last, iterator dest)
+            {
+                for (; first != last; ++first, ++dest)
+                    *dest = *first;
+            }
+
+            static void copy_backward(iterator first, iterator last, iterator dest_last)
+            {
+                while (first != last)
+                    *--dest_last = *--last;
+            }
+
+            static void fill(iterator first, iterator last, const value_type& val)
+            {
+                for (; first != last; ++first)
+                    *first = val;
+            }
+    };
+
+    // ===========================================Non-member function overloads===========================================
+    template <class T, class Alloc>
+    bool operator== (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+    { return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+
+    template <class T, class Alloc>
+    bool operator!= (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+    { return !(lhs == rhs); }
+
+    template <class T, class Alloc>
+    bool operator<  (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+    { return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+    template <class T, class Alloc>
+    bool operator<= (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+    { return !(rhs < lhs); }
+
+    template <class T, class Alloc>
+    bool operator>  (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+    { return rhs < lhs; }
+
+    template <class T, class Alloc>
+    bool operator>= (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+    { return !(lhs < rhs); }
+
+    template <class T, class Alloc>
+    void swap (deque<T,Alloc>& x, deque<T,Alloc>& y)
+    { x.swap(y); }
+}
+
+#endif
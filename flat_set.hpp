@@ -0,0 +1,168 @@
+#ifndef FLAT_SET_HPP
+#define FLAT_SET_HPP
+
+#include "flat_tree.hpp"
+
+namespace ft
+{
+    // 정렬된 ft::vector 하나에 key를 모아 둔 set. (flat_tree.hpp)
+    // insert / erase는 O(n)이고 그 뒤에는 iterator가 무효가 된다.
+    template <class Key, class Compare = std::less<Key>, class Allocator = std::allocator<Key> >
+    class flat_set
+    {
+        public:    
+            typedef Key                                                                 key_type;
+            typedef Key                                                                 value_type;
+            typedef Compare                                                             key_compare;
+            typedef Compare                                                             value_compare;
+            typedef Allocator                                                           allocator_type;
+            typedef typename allocator_type::reference                                  reference;
+            typedef typename allocator_type::const_reference                            const_reference;
+            typedef typename allocator_type::pointer                                    pointer;
+            typedef typename allocator_type::const_pointer                              const_pointer;
+            typedef typename ft::flat_tree<key_type, key_compare, allocator_type>       tree_type;
+            typedef typename tree_type::container_type                                  container_type;
+            typedef typename tree_type::const_iterator                                  iterator;
+            typedef typename tree_type::const_iterator                                  const_iterator;
+            typedef typename tree_type::const_reverse_iterator                          reverse_iterator;
+            typedef typename tree_type::const_reverse_iterator	                        const_reverse_iterator;
+            typedef typename std::ptrdiff_t                                             difference_type;
+            typedef typename std::size_t                                                size_type;
+        private:
+            tree_type   _tree;
+        public:
+            explicit flat_set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _tree(comp, alloc) {}
+            template <class InputIterator>  
+            flat_set (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _tree(comp, alloc)
+            { this->insert(first, last); }
+            template <class InputIterator>
+            flat_set (ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _tree(comp, alloc)
+            { _tree.insert(ft::sorted_unique, first, last); }
+            flat_set (ft::sorted_unique_t, container_type& values, const key_compare& comp = key_compare()): _tree(ft::sorted_unique, values, comp) {}
+            flat_set (const flat_set& x): _tree(x._tree) {}
+            ~flat_set() {}
+            flat_set& operator=(const flat_set& x)
+            {
+                if (this != &x)
+                    _tree = x._tree;
+                return (*this);
+            }
+#if __cplusplus >= 201103L
+            flat_set (flat_set&& x): _tree(std::move(x._tree)) {}
+            flat_set& operator=(flat_set&& x)
+            {
+                _tree = std::move(x._tree);
+                return (*this);
+            }
+#endif
+
+            // ============================================Iterators============================================
+            iterator begin() { return (_tree.begin()); }
+            const_iterator begin() const { return (_tree.begin()); }
+            iterator end() { return (_tree.end()); }
+            const_iterator end() const { return (_tree.end()); }
+            reverse_iterator rbegin() { return (_tree.rbegin()); }
+            const_reverse_iterator rbegin() const { return (_tree.rbegin()); }
+            reverse_iterator rend() { return (_tree.rend()); }
+            const_reverse_iterator rend() const { return (_tree.rend()); }
+        
+            // =============================================Capacity=============================================
+            bool empty() const { return (_tree.empty()); }
+            size_type size() const { return (_tree.size()); }
+            size_type max_size() const { return (_tree.max_size()); }
+            size_type capacity() const { return (_tree.capacity()); }
+            void reserve(size_type n) { _tree.reserve(n); }
+
+            // =============================================Modifiers=============================================
+            ft::pair<iterator, bool> insert(const value_type& x) { return (_tree.insert(x)); }
+            iterator insert(iterator position, const value_type& x) { return (_tree.insert(position, x)); }
+            template <typename InputIterator>
+            void insert(InputIterator first, InputIterator last) { _tree.insert(first, last); }
+            template <typename InputIterator>
+            void insert(ft::sorted_unique_t, InputIterator first, InputIterator last) { _tree.insert(ft::sorted_unique, first, last); }
+            iterator erase(iterator position) { return (_tree.erase(position)); }
+            size_type erase(const key_type& x) { return (_tree.erase(x)); }
+            void erase(iterator first, iterator last) { _tree.erase(first, last); }
+            void swap(flat_set& x) { _tree.swap(x._tree); }
+            void clear() { _tree.clear(); }
+
+            // 정렬하지 않고 쌓아 두었다가 commit()이나 다음 조회 때 한 번에 정렬한다.
+            void insert_deferred(const value_type& x) { _tree.insert_deferred(x); }
+            template <typename InputIterator>
+            void insert_deferred(InputIterator first, InputIterator last) { _tree.insert_deferred(first, last); }
+            void commit() const { _tree.commit(); }
+
+            // =============================================Observers=============================================
+            key_compare key_comp() const { return (_tree.value_comp()); }
+            value_compare value_comp() const { return (_tree.value_comp()); }
+
+            // =============================================Operations=============================================
+            iterator find(const key_type& x) { return (_tree.find(x)); }
+            const_iterator find(const key_type& x) const { return (_tree.find(x)); }
+            size_type count(const key_type& x) const { return (_tree.count(x)); }
+            iterator lower_bound(const key_type& x) { return (_tree.lower_bound(x)); }
+            const_iterator lower_bound(const key_type& x) const { return (_tree.lower_bound(x)); }
+            iterator upper_bound(const key_type& x) { return (_tree.upper_bound(x)); }
+            const_iterator upper_bound(const key_type& x) const { return (_tree.upper_bound(x)); }
+            ft::pair<iterator,iterator> equal_range(const key_type& x) { return (_tree.equal_range(x)); }
+            ft::pair<const_iterator,const_iterator> equal_range(const key_type& x) const { return (_tree.equal_range(x)); }
+
+            // transparent comparator(ft::less<> 등)일 때만 쓸 수 있는 key_type 이외의 타입으로 검색하는 overload
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type find(const K& x) { return (_tree.find(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type find(const K& x) const { return (_tree.find(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, size_type>::type count(const K& x) const { return (_tree.count(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type lower_bound(const K& x) { return (_tree.lower_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type lower_bound(const K& x) const { return (_tree.lower_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type upper_bound(const K& x) { return (_tree.upper_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type upper_bound(const K& x) const { return (_tree.upper_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, ft::pair<iterator, iterator> >::type equal_range(const K& x) { return (_tree.equal_range(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, ft::pair<const_iterator, const_iterator> >::type equal_range(const K& x) const { return (_tree.equal_range(x)); }
+
+            // =============================================Allocator=============================================
+            allocator_type get_allocator() const { return _tree.get_allocator(); }
+    };
+
+    template <class Key_, class Compare_, class Alloc>
+	bool operator==(const flat_set<Key_,Compare_,Alloc>& x, const ft::flat_set<Key_,Compare_,Alloc>& y)
+	{
+		if (x.size() != y.size())
+			return false;
+		return ft::equal(x.begin(), x.end(), y.begin());
+	}
+    template <class Key_, class Compare_, class Alloc>
+	bool operator!=(const flat_set<Key_,Compare_,Alloc>& x, const flat_set<Key_,Compare_,Alloc>& y) 
+    { return !(x == y); }
+
+	template <class Key_, class Compare_, class Alloc>
+	bool operator< (const flat_set<Key_,Compare_,Alloc>& x, const flat_set<Key_,Compare_,Alloc>& y)
+	{
+		return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+	}
+
+	template <class Key_, class Compare_, class Alloc>
+	bool operator> (const flat_set<Key_,Compare_,Alloc>& x, const flat_set<Key_,Compare_,Alloc>& y) 
+    { return y < x; }
+
+	template <class Key_, class Compare_, class Alloc>
+	bool operator>=(const flat_set<Key_,Compare_,Alloc>& x, const flat_set<Key_,Compare_,Alloc>& y)
+    { return !(x < y); }
+
+	template <class Key_, class Compare_, class Alloc>
+	bool operator<=(const flat_set<Key_,Compare_,Alloc>& x, const flat_set<Key_,Compare_,Alloc>& y) 
+    { return !(y < x); }
+
+    template <class Key_, class Compare_, class Alloc>
+    void swap(ft::flat_set<Key_,  Compare_, Alloc>& x, ft::flat_set<Key_,  Compare_, Alloc>& y) 
+    { x.swap(y); }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,424 @@
+#ifndef FLAT_TREE_HPP
+#define FLAT_TREE_HPP
+
+#include <memory>
+#include <functional>
+#include <cstddef>
+#include "vector.hpp"
+#include "algorithm.hpp"
+#include "pair.hpp"
+
+namespace ft
+{
+    // 이미 key 순서로 정렬되어 있고 중복이 없는 입력이라는 표시. flat_map / flat_set이 정렬과 중복 검사를 건너뛴다.
+    //   ft::flat_map<int, int> table(ft::sorted_unique, values);
+    struct sorted_unique_t {};
+    static const sorted_unique_t sorted_unique = sorted_unique_t();
+
+    // ============================================flat tree============================================
+    // 정렬된 ft::vector 하나에 값을 모아 두고 이분 탐색으로 찾는다. flat_map / flat_set이 쓴다.
+    // 노드 포인터가 없어서 원소당 메모리가 sizeof(value_type)뿐이고, 탐색이 연속된 메모리 안에서 끝난다.
+    // 대신 insert / erase는 뒤쪽 원소를 옮기므로 O(n)이고, 그 뒤에는 iterator가 무효가 된다.
+    //
+    // insert_deferred로 넣은 값은 정렬하지 않고 뒤에 쌓아 두었다가(_sorted 이후),
+    // 다음에 원소를 읽거나 바꿀 때(또는 commit()) 한 번에 정렬해서 합친다.
+    // 그래서 읽기 전용 함수들도 _values를 바꿀 수 있다 (mutable). 여러 스레드에서 읽기만 하기 전에는 commit()을 불러둔다.
+    template <typename T, typename Compare = std::less<T>, typename Alloc = std::allocator<T> >
+    class flat_tree
+    {
+        public:
+            typedef T                                                           value_type;
+            typedef Compare                                                     value_compare;
+            typedef Alloc                                                       allocator_type;
+            typedef ft::vector<value_type, allocator_type>                      container_type;
+            typedef typename allocator_type::pointer                            pointer;
+            typedef typename allocator_type::const_pointer                      const_pointer;
+            typedef typename allocator_type::reference                          reference;
+            typedef typename allocator_type::const_reference                    const_reference;
+            typedef std::ptrdiff_t                                              difference_type;
+            typedef std::size_t                                                 size_type;
+            typedef typename container_type::iterator                           iterator;
+            typedef typename container_type::const_iterator                     const_iterator;
+            typedef typename container_type::reverse_iterator                   reverse_iterator;
+            typedef typename container_type::const_reverse_iterator             const_reverse_iterator;
+
+        private:
+            // 정렬 중에 작은 구간은 삽입 정렬로 끝낸다.
+            static const difference_type    insertion_sort_limit = 16;
+
+            mutable container_type  _values;
+            mutable size_type       _sorted;    // [0, _sorted)는 정렬되어 있고 중복이 없다.
+            value_compare           _compare;
+
+        public:
+            flat_tree(const value_compare &comp, const allocator_type &alloc)
+                : _values(alloc), _sorted(0), _compare(comp) {}
+
+            // 정렬되어 있고 중복이 없는 values를 복사 없이 가져온다(swap). values는 빈 vector가 된다.
+            flat_tree(ft::sorted_unique_t, container_type& values, const value_compare &comp)
+                : _values(values.get_allocator()), _sorted(0), _compare(comp)
+            {
+                _values.swap(values);
+                _sorted = _values.size();
+            }
+
+            flat_tree(const flat_tree &obj)
+                : _values(obj.committed()), _sorted(obj._sorted), _compare(obj._compare) {}
+
+            ~flat_tree() {}
+
+            flat_tree& operator=(const flat_tree &obj)
+            {
+                if (this != &obj)
+                {
+                    container_type values(obj.committed());
+                    _values.swap(values);
+                    _sorted = obj._sorted;
+                    _compare = obj._compare;
+                }
+                return *this;
+            }
+#if __cplusplus >= 201103L
+            flat_tree(flat_tree&& obj)
+                : _values(std::move(obj._values)), _sorted(obj._sorted), _compare(obj._compare)
+            {
+                obj._sorted = 0;
+            }
+            flat_tree& operator=(flat_tree&& obj)
+            {
+                if (this != &obj)
+                {
+                    _values = std::move(obj._values);
+                    _sorted = obj._sorted;
+                    _compare = obj._compare;
+                    obj._sorted = 0;
+                }
+                return *this;
+            }
+#endif
+
+            iterator begin() { return this->committed().begin(); }
+            const_iterator begin() const { return this->committed().begin(); }
+            iterator end() { return this->committed().end(); }
+            const_iterator end() const { return this->committed().end(); }
+            reverse_iterator rbegin() { return this->committed().rbegin(); }
+            const_reverse_iterator rbegin() const { return this->committed().rbegin(); }
+            reverse_iterator rend() { return this->committed().rend(); }
+            const_reverse_iterator rend() const { return this->committed().rend(); }
+
+            bool empty() const { return _values.empty(); }
+            size_type size() const { return this->committed().size(); }
+            size_type max_size() const { return _values.max_size(); }
+            size_type capacity() const { return _values.capacity(); }
+            void reserve(size_type n) { _values.reserve(n); }
+
+            ft::pair<iterator, bool> insert(const value_type& val)
+            {
+                iterator pos = this->lower_bound(val);
+                if (pos != _values.end() && !this->_compare(val, *pos))
+                    return ft::make_pair(pos, false);
+                pos = _values.insert(pos, val);
+                ++_sorted;
+                return ft::make_pair(pos, true);
+            }
+
+            // position 바로 앞에 val이 들어갈 자리가 맞으면 이분 탐색을 하지 않는다.
+            iterator insert(const_iterator position, const value_type& val)
+            {
+                iterator pos = this->to_iterator(position);
+
+                if ((pos == _values.end() || this->_compare(val, *pos))
+                    && (pos == _values.begin() || this->_compare(*(pos - 1), val)))
+                {
+                    pos = _values.insert(pos, val);
+                    ++_sorted;
+                    return pos;
+                }
+                return this->insert(val).first;
+            }
+
+            // 범위는 뒤에 붙인 다음 한 번에 정렬해서 합친다. O(n + k log k)
+            template<typename InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                this->insert_deferred(first, last);
+                this->commit();
+            }
+
+            // 정렬되어 있고 중복이 없는 범위. 정렬 없이 합친다. (이미 있는 값보다 모두 크면 뒤에 붙이기만 한다)
+            template<typename InputIterator>
+            void insert(ft::sorted_unique_t, InputIterator first, InputIterator last)
+            {
+                this->commit();
+                for (; first != last; ++first)
+                    _values.push_back(*first);
+                if (_sorted > 0 && _sorted < _values.size() && !this->_compare(_values[_sorted - 1], _values[_sorted]))
+                    this->merge_pending();
+                _sorted = _values.size();
+            }
+
+            // 정렬하지 않고 뒤에 쌓아 둔다. 이미 있는 key라면 commit할 때 버려진다. (먼저 들어간 값이 남는다)
+            void insert_deferred(const value_type& val) { _values.push_back(val); }
+
+            template<typename InputIterator>
+            void insert_deferred(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                    _values.push_back(*first);
+            }
+
+            // insert_deferred로 쌓인 값을 정렬해서 합친다.
+            void commit() const
+            {
+                if (_sorted != _values.size())
+                    this->sort_pending();
+            }
+
+            iterator erase(const_iterator position)
+            {
+                iterator pos = this->to_iterator(position);
+                --_sorted;
+                return _values.erase(pos);
+            }
+
+            iterator erase(iterator position) { return this->erase(const_iterator(position)); }
+
+            template <typename Key>
+            size_type erase(const Key& key)
+            {
+                iterator iter = this->find(key);
+                if (iter == _values.end())
+                    return 0;
+                this->erase(iter);
+                return 1;
+            }
+
+            void erase(const_iterator first, const_iterator last)
+            {
+                // 빈 vector의 erase는 &*first를 하므로 빈 범위는 여기서 끝낸다.
+                if (first == last)
+                    return ;
+                iterator pos = this->to_iterator(first);
+                _sorted -= last - first;
+                _values.erase(pos, pos + (last - first));
+            }
+
+            void swap(flat_tree& t)
+            {
+                _values.swap(t._values);
+                ft::swap(this->_sorted, t._sorted);
+                ft::swap(this->_compare, t._compare);
+            }
+
+            void clear()
+            {
+                _values.clear();
+                _sorted = 0;
+            }
+
+            template <typename Key>
+            size_type count(const Key& key) const
+            {
+                // find가 먼저 commit해야 하므로 end()를 같은 식에서 부르지 않는다. (merge_pending은 vector를 바꾼다)
+                const_iterator pos = this->find(key);
+                return pos != this->end();
+            }
+
+            template <typename Key>
+            iterator find(const Key& key)
+            {
+                iterator pos = this->lower_bound(key);
+                if (pos != _values.end() && !this->_compare(key, *pos))
+                    return pos;
+                return _values.end();
+            }
+
+            template <typename Key>
+            const_iterator find(const Key& key) const
+            {
+                return const_cast<flat_tree*>(this)->find(key);
+            }
+
+            template <typename Key>
+            iterator lower_bound(const Key& key)
+            {
+                iterator first = this->begin();
+                difference_type len = _values.end() - first;
+
+                while (len > 0)
+                {
+                    difference_type half = len >> 1;
+                    if (this->_compare(first[half], key))
+                    {
+                        first += half + 1;
+                        len -= half + 1;
+                    }
+                    else
+                        len = half;
+                }
+                return first;
+            }
+
+            template <typename Key>
+            const_iterator lower_bound(const Key& key) const
+            {
+                return const_cast<flat_tree*>(this)->lower_bound(key);
+            }
+
+            template <typename Key>
+            iterator upper_bound(const Key& key)
+            {
+                iterator first = this->begin();
+                difference_type len = _values.end() - first;
+
+                while (len > 0)
+                {
+                    difference_type half = len >> 1;
+                    if (!this->_compare(key, first[half]))
+                    {
+                        first += half + 1;
+                        len -= half + 1;
+                    }
+                    else
+                        len = half;
+                }
+                return first;
+            }
+
+            template <typename Key>
+            const_iterator upper_bound(const Key& key) const
+            {
+                return const_cast<flat_tree*>(this)->upper_bound(key);
+            }
+
+            template <typename Key>
+            ft::pair<iterator,iterator> equal_range(const Key& key)
+            {
+                return ft::make_pair(this->lower_bound(key), this->upper_bound(key));
+            }
+            template <typename Key>
+            ft::pair<const_iterator,const_iterator> equal_range(const Key& key) const
+            {
+                return ft::make_pair(this->lower_bound(key), this->upper_bound(key));
+            }
+
+            value_compare value_comp() const { return this->_compare; }
+            allocator_type get_allocator() const { return _values.get_allocator(); }
+
+        private:
+            // 정렬된 상태에서 받은 const_iterator를 같은 자리의 iterator로 바꾼다.
+            iterator to_iterator(const_iterator position)
+            {
+                this->commit();
+                return _values.begin() + (position - const_iterator(_values.begin()));
+            }
+
+            container_type& committed() const
+            {
+                this->commit();
+                return _values;
+            }
+
+            // 뒤에 쌓인 값을 안정 정렬하고, 앞쪽과 겹치면 합친다. 같은 key는 먼저 들어간 값만 남긴다.
+            void sort_pending() const
+            {
+                iterator first = _values.begin() + _sorted;
+                iterator last = _values.end();
+                container_type buffer(_values.get_allocator());
+
+                this->merge_sort(first, last, buffer);
+                if (_sorted == 0 || this->_compare(_values[_sorted - 1], *first))
+                    this->unique_pending();
+                else
+                    this->merge_pending();
+                _sorted = _values.size();
+            }
+
+            // [first, last)를 안정 정렬한다. buffer는 병합할 때 앞 절반을 잠시 옮겨 두는 곳
+            // C++11에서는 원소를 복사하지 않고 move한다.
+            void merge_sort(iterator first, iterator last, container_type& buffer) const
+            {
+                difference_type n = last - first;
+
+                if (n <= insertion_sort_limit)
+                {
+                    for (iterator it = first + 1; it < last; ++it)
+                    {
+                        if (!this->_compare(*it, *(it - 1)))
+                            continue;
+                        value_type tmp(FT_MOVE(*it));
+                        iterator hole = it;
+                        for (; hole != first && this->_compare(tmp, *(hole - 1)); --hole)
+                            *hole = FT_MOVE(*(hole - 1));
+                        *hole = FT_MOVE(tmp);
+                    }
+                    return ;
+                }
+                iterator middle = first + n / 2;
+                this->merge_sort(first, middle, buffer);
+                this->merge_sort(middle, last, buffer);
+                if (!this->_compare(*middle, *(middle - 1)))
+                    return ;
+
+                buffer.clear();
+                buffer.reserve(middle - first);
+                for (iterator it = first; it != middle; ++it)
+                    buffer.push_back(FT_MOVE(*it));
+                iterator left = buffer.begin();
+                iterator left_end = buffer.end();
+                iterator right = middle;
+                iterator out = first;
+                while (left != left_end && right != last)
+                {
+                    // 같으면 앞 절반(먼저 들어간 값)을 먼저 둔다.
+                    if (this->_compare(*right, *left))
+                        *out++ = FT_MOVE(*right++);
+                    else
+                        *out++ = FT_MOVE(*left++);
+                }
+                while (left != left_end)
+                    *out++ = FT_MOVE(*left++);
+            }
+
+            // 뒤쪽이 모두 앞쪽보다 큰 경우: 뒤쪽 안의 중복만 제자리에서 지운다.
+            void unique_pending() const
+            {
+                iterator out = _values.begin() + _sorted + 1;
+                for (iterator it = out; it != _values.end(); ++it)
+                {
+                    if (this->_compare(*(out - 1), *it))
+                    {
+                        if (out != it)
+                            *out = FT_MOVE(*it);
+                        ++out;
+                    }
+                }
+                _values.erase(out, _values.end());
+            }
+
+            // 정렬된 앞쪽 [0, _sorted)와 정렬된 뒤쪽을 새 vector로 합친다. 같은 key는 앞쪽 값이 남는다.
+            void merge_pending() const
+            {
+                container_type merged(_values.get_allocator());
+                merged.reserve(_values.size());
+                iterator left = _values.begin();
+                iterator left_end = _values.begin() + _sorted;
+                iterator right = left_end;
+                iterator right_end = _values.end();
+
+                while (left != left_end || right != right_end)
+                {
+                    value_type* next;
+                    if (right == right_end || (left != left_end && !this->_compare(*right, *left)))
+                        next = &*left++;
+                    else
+                        next = &*right++;
+                    if (merged.empty() || this->_compare(merged.back(), *next))
+                        merged.push_back(FT_MOVE(*next));
+                }
+                _values.swap(merged);
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,915 @@
+#ifndef HASH_TABLE_HPP
+#define HASH_TABLE_HPP
+
+#include <memory>
+#include <functional>
+#include <string>
+#include <cstddef>
+#include <cstring>
+#include <climits>
+#include "iterator_base.hpp"
+#include "algorithm.hpp"
+#include "pair.hpp"
+#include "type_traits.hpp"
+
+// metadata 16 byte를 SSE2 명령 몇 개로 한 번에 비교한다. -D FT_HASH_TABLE_SIMD=0이면 byte마다 비교한다.
+#ifndef FT_HASH_TABLE_SIMD
+# ifdef __SSE2__
+#  define FT_HASH_TABLE_SIMD 1
+# else
+#  define FT_HASH_TABLE_SIMD 0
+# endif
+#endif
+
+#if FT_HASH_TABLE_SIMD
+# include <emmintrin.h>
+#endif
+
+namespace ft
+{
+    // ===============================================hash===============================================
+    // 정의가 없는 type을 key로 쓰면 컴파일 오류가 나도록 기본 template은 선언만 한다.
+    template <typename T>
+    struct hash;
+
+    // 정수는 값 그대로 쓴다. 흩뜨리는 일은 hash_table이 한다. (hash_table::mix)
+    template <typename T>
+    struct integral_hash
+    {
+        typedef T           argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(T x) const { return static_cast<std::size_t>(x); }
+    };
+
+    template <>
+    struct hash<bool> : public integral_hash<bool> {};
+
+    template <>
+    struct hash<char> : public integral_hash<char> {};
+
+#if __cplusplus >= 201103L
+    template <>
+    struct hash<char16_t> : public integral_hash<char16_t> {};
+
+    template <>
+    struct hash<char32_t> : public integral_hash<char32_t> {};
+#endif
+
+    template <>
+    struct hash<signed char> : public integral_hash<signed char> {};
+
+    template <>
+    struct hash<unsigned char> : public integral_hash<unsigned char> {};
+
+    template <>
+    struct hash<wchar_t> : public integral_hash<wchar_t> {};
+
+    template <>
+    struct hash<short int> : public integral_hash<short int> {};
+
+    template <>
+    struct hash<unsigned short int> : public integral_hash<unsigned short int> {};
+
+    template <>
+    struct hash<int> : public integral_hash<int> {};
+
+    template <>
+    struct hash<unsigned int> : public integral_hash<unsigned int> {};
+
+    template <>
+    struct hash<long int> : public integral_hash<long int> {};
+
+    template <>
+    struct hash<unsigned long int> : public integral_hash<unsigned long int> {};
+
+#if __cplusplus >= 201103L
+    template <>
+    struct hash<long long int> : public integral_hash<long long int> {};
+
+    template <>
+    struct hash<unsigned long long int> : public integral_hash<unsigned long long int> {};
+#endif
+
+    // 실수는 bit 표현을 쓴다. 0.0 == -0.0인데 bit가 다르므로 0은 따로 처리한다.
+    // size_t보다 긴 type은 size_t 단위로 잘라 xor한다.
+    template <typename T>
+    struct floating_point_hash
+    {
+        typedef T           argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(T x) const
+        {
+            if (x == 0)
+                return 0;
+            std::size_t h = 0;
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&x);
+            for (std::size_t i = 0; i < sizeof(T); i += sizeof(std::size_t))
+            {
+                std::size_t word = 0;
+                std::memcpy(&word, bytes + i, sizeof(T) - i < sizeof(std::size_t) ? sizeof(T) - i : sizeof(std::size_t));
+                h ^= word;
+            }
+            return h;
+        }
+    };
+
+    template <>
+    struct hash<float> : public floating_point_hash<float> {};
+
+    template <>
+    struct hash<double> : public floating_point_hash<double> {};
+
+    template <typename T>
+    struct hash<T*>
+    {
+        typedef T*          argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(T* p) const { return reinterpret_cast<std::size_t>(p); }
+    };
+
+    // FNV-1a
+    template <>
+    struct hash<std::string>
+    {
+        typedef std::string argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(const std::string& s) const
+        {
+            std::size_t h = 2166136261UL;
+            for (std::string::size_type i = 0; i < s.size(); i++)
+            {
+                h ^= static_cast<unsigned char>(s[i]);
+                h *= 16777619UL;
+            }
+            return h;
+        }
+    };
+
+    template <typename T>
+    struct equal_to
+    {
+        typedef T       first_argument_type;
+        typedef T       second_argument_type;
+        typedef bool    result_type;
+
+        bool operator()(const T& x, const T& y) const { return x == y; }
+    };
+
+    // ===========================================hash control===========================================
+    // slot마다 metadata 1 byte를 둔다.
+    //   0 ~ 127 : 값이 있는 slot. hash의 7 bit(h2)를 적어 두어서 대부분의 다른 key는 값을 읽지 않고 거른다.
+    //   empty   : 빈 slot
+    //   end     : 배열 끝 다음에 한 byte 더 두는 표시. iterator가 여기서 멈춘다.
+    struct hash_control
+    {
+        static const signed char    empty = -128;
+        static const signed char    end = -1;
+        static const std::size_t    group_width = 16;
+    };
+
+    // mask에서 가장 낮은 bit의 index. mask는 0이 아니어야 한다.
+    inline int hash_first_bit(unsigned mask)
+    {
+#ifdef __GNUC__
+        return __builtin_ctz(mask);
+#else
+        int i = 0;
+        while (!(mask & 1u))
+        {
+            mask >>= 1;
+            i++;
+        }
+        return i;
+#endif
+    }
+
+    // ============================================hash group============================================
+    // metadata 16 byte를 읽어서 h2와 같은 byte, 빈 byte의 위치를 bit mask(bit i == slot i)로 돌려준다.
+#if FT_HASH_TABLE_SIMD
+    class hash_group
+    {
+        private:
+            __m128i _bytes;
+        public:
+            explicit hash_group(const signed char* control): _bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) {}
+            unsigned match(signed char h2) const
+            { return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_bytes, _mm_set1_epi8(h2)))); }
+            unsigned match_empty() const { return this->match(hash_control::empty); }
+    };
+#else
+    class hash_group
+    {
+        private:
+            const signed char*  _bytes;
+        public:
+            explicit hash_group(const signed char* control): _bytes(control) {}
+            unsigned match(signed char h2) const
+            {
+                unsigned mask = 0;
+                for (std::size_t i = 0; i < hash_control::group_width; i++)
+                    if (_bytes[i] == h2)
+                        mask |= 1u << i;
+                return mask;
+            }
+            unsigned match_empty() const { return this->match(hash_control::empty); }
+    };
+#endif
+
+    // ============================================Iterators============================================
+    // metadata와 slot을 같이 움직이다가 값이 있는 slot에서 멈춘다. 배열 끝의 end byte에서 멈추므로 끝을 따로 검사하지 않는다.
+    // rehash하면 모든 iterator가 무효가 된다. erase는 뒤쪽 값을 앞으로 당기므로 지운 자리 뒤의 iterator도 무효가 된다.
+    template <typename T>
+    class hash_table_iterator
+    {
+        public:
+            typedef ft::forward_iterator_tag    iterator_category;
+            typedef std::ptrdiff_t              difference_type;
+            typedef T                           value_type;
+            typedef T*                          pointer;
+            typedef T&                          reference;
+
+        private:
+            const signed char*  _control;
+            pointer             _slot;
+
+        public:
+            hash_table_iterator(): _control(), _slot() {}
+            hash_table_iterator(const hash_table_iterator& iter): _control(iter._control), _slot(iter._slot) {}
+            hash_table_iterator(const signed char* control, pointer slot): _control(control), _slot(slot) {}
+            hash_table_iterator& operator=(const hash_table_iterator& iter)
+            {
+                _control = iter._control;
+                _slot = iter._slot;
+                return *this;
+            }
+            reference operator*() const { return *_slot; }
+            pointer operator->() const { return _slot; }
+            hash_table_iterator& operator++()
+            {
+                do
+                {
+                    ++_control;
+                    ++_slot;
+                } while (*_control == hash_control::empty);
+                return *this;
+            }
+            hash_table_iterator operator++(int)
+            {
+                hash_table_iterator rtn(*this);
+                ++(*this);
+                return rtn;
+            }
+            const signed char* control() const { return _control; }
+            pointer base() const { return _slot; }
+    };
+
+    template<typename T>
+    bool operator==(const hash_table_iterator<T>& rhs, const hash_table_iterator<T>& lhs)
+    { return rhs.base() == lhs.base(); }
+
+    template<typename T>
+    bool operator!=(const hash_table_iterator<T>& rhs, const hash_table_iterator<T>& lhs)
+    { return rhs.base() != lhs.base(); }
+
+    // =========================================Const Iterators=========================================
+    template <typename T>
+    class hash_table_const_iterator
+    {
+        public:
+            typedef ft::forward_iterator_tag    iterator_category;
+            typedef std::ptrdiff_t              difference_type;
+            typedef T                           value_type;
+            typedef const T*                    pointer;
+            typedef const T&                    reference;
+            typedef hash_table_iterator<T>      origin_iterator;
+
+        private:
+            const signed char*  _control;
+            pointer             _slot;
+
+        public:
+            hash_table_const_iterator(): _control(), _slot() {}
+            hash_table_const_iterator(const hash_table_const_iterator& iter): _control(iter._control), _slot(iter._slot) {}
+            hash_table_const_iterator(const origin_iterator& iter): _control(iter.control()), _slot(iter.base()) {}
+            hash_table_const_iterator(const signed char* control, pointer slot): _control(control), _slot(slot) {}
+            hash_table_const_iterator& operator=(const hash_table_const_iterator& iter)
+            {
+                _control = iter._control;
+                _slot = iter._slot;
+                return *this;
+            }
+            reference operator*() const { return *_slot; }
+            pointer operator->() const { return _slot; }
+            hash_table_const_iterator& operator++()
+            {
+                do
+                {
+                    ++_control;
+                    ++_slot;
+                } while (*_control == hash_control::empty);
+                return *this;
+            }
+            hash_table_const_iterator operator++(int)
+            {
+                hash_table_const_iterator rtn(*this);
+                ++(*this);
+                return rtn;
+            }
+            const signed char* control() const { return _control; }
+            pointer base() const { return _slot; }
+    };
+
+    template<typename T>
+    inline bool operator==(const hash_table_const_iterator<T>& rhs, const hash_table_const_iterator<T>& lhs)
+    { return rhs.base() == lhs.base(); }
+
+    template<typename T>
+    inline bool operator!=(const hash_table_const_iterator<T>& rhs, const hash_table_const_iterator<T>& lhs)
+    { return rhs.base() != lhs.base(); }
+
+    template<typename T>
+    inline bool operator==(const hash_table_const_iterator<T>& rhs, const hash_table_iterator<T>& lhs)
+    { return rhs.base() == lhs.base(); }
+
+    template<typename T>
+    inline bool operator!=(const hash_table_const_iterator<T>& rhs, const hash_table_iterator<T>& lhs)
+    { return rhs.base() != lhs.base(); }
+
+    template<typename T>
+    inline bool operator==(const hash_table_iterator<T>& rhs, const hash_table_const_iterator<T>& lhs)
+    { return rhs.base() == lhs.base(); }
+
+    template<typename T>
+    inline bool operator!=(const hash_table_iterator<T>& rhs, const hash_table_const_iterator<T>& lhs)
+    { return rhs.base() != lhs.base(); }
+
+    // ============================================Hash table============================================
+    // unordered_map / unordered_set이 쓰는 open addressing hash table.
+    // 값은 노드 없이 slot 배열에 바로 들어가고, slot마다 metadata 1 byte(hash_control)를 따로 둔다.
+    // key는 hash의 위쪽 bit가 가리키는 slot(home)부터 선형으로 찾는다(linear probing).
+    // 찾을 때는 home이 속한 16 slot 묶음(group)의 metadata를 한 번에 비교해서 h2가 같은 slot만 값을 비교하고,
+    // 빈 slot을 만나면 그 뒤에는 key가 없으므로 멈춘다.
+    //
+    // 배열은 처음으로 돌아가지 않는다(wrap-around 없음). home은 [0, _capacity) 안에 있고,
+    // 뒤에 group 하나만큼 slot을 더 두어서 끝에서 넘치는 값을 받는다. 그래도 넘치면 capacity를 늘린다.
+    //
+    // erase는 tombstone을 남기지 않는다. 지운 자리 뒤로 빈 slot까지 이어지는 값들 중
+    // home이 빈 자리보다 앞에 있는 값을 당겨 채운다(backward shift). 그래서 찾기가 지운 횟수에 따라 느려지지 않는다.
+    //
+    // Hash는 값과 key 둘 다 받을 수 있어야 하고, Equal은 (값, 값)과 (값, key)를 비교할 수 있어야 한다. (rb_tree의 value_compare와 같다)
+    template <typename T, typename Hash = ft::hash<T>, typename Equal = ft::equal_to<T>, typename Alloc = std::allocator<T> >
+    class hash_table
+    {
+        public:
+            typedef T                                                               value_type;
+            typedef Hash                                                            value_hash;
+            typedef Equal                                                           value_equal;
+            typedef Alloc                                                           allocator_type;
+            typedef typename allocator_type::template rebind<signed char>::other    control_alloc_type;
+            typedef typename allocator_type::pointer                                pointer;
+            typedef typename allocator_type::const_pointer                          const_pointer;
+            typedef typename allocator_type::reference                              reference;
+            typedef typename allocator_type::const_reference                        const_reference;
+            typedef std::ptrdiff_t                                                  difference_type;
+            typedef std::size_t                                                     size_type;
+            typedef ft::hash_table_iterator<value_type>                             iterator;
+            typedef ft::hash_table_const_iterator<value_type>                       const_iterator;
+
+        private:
+            static const size_type  group_width = hash_control::group_width;
+            static const size_type  min_capacity = hash_control::group_width;
+
+            signed char*        _control;       // _slot_count + 1 byte. 마지막 byte는 hash_control::end
+            pointer             _slots;
+            size_type           _capacity;      // home의 범위. 0 또는 2의 거듭제곱
+            size_type           _slot_count;    // _capacity + group_width
+            int                 _shift;         // home = mix(hash) >> _shift
+            size_type           _size;
+            size_type           _growth_limit;  // size가 이보다 커지면 capacity를 늘린다.
+            float               _max_load;
+            value_hash          _hash;
+            value_equal         _equal;
+            allocator_type      _value_alloc;
+            control_alloc_type  _control_alloc;
+
+        public:
+            hash_table(size_type n, const value_hash& hash, const value_equal& equal, const allocator_type& alloc)
+                : _control(NULL), _slots(NULL), _capacity(0), _slot_count(0), _shift(0), _size(0), _growth_limit(0), _max_load(0.875f),
+                  _hash(hash), _equal(equal), _value_alloc(alloc), _control_alloc(alloc)
+            {
+                if (n > 0)
+                    this->rehash(n);
+            }
+            hash_table(const hash_table& obj)
+                : _control(NULL), _slots(NULL), _capacity(0), _slot_count(0), _shift(0), _size(0), _growth_limit(0), _max_load(obj._max_load),
+                  _hash(obj._hash), _equal(obj._equal), _value_alloc(obj._value_alloc), _control_alloc(obj._control_alloc)
+            {
+                this->copy_from(obj);
+            }
+            ~hash_table()
+            {
+                this->clear();
+                this->deallocate(_control, _slots, _slot_count);
+            }
+            hash_table& operator=(const hash_table& obj)
+            {
+                if (this != &obj)
+                {
+                    hash_table tmp(obj);
+                    this->swap(tmp);
+                }
+                return *this;
+            }
+#if __cplusplus >= 201103L
+            // 배열은 움직이지 않고 빈 table과 바꾼다.
+            hash_table(hash_table&& obj)
+                : _control(NULL), _slots(NULL), _capacity(0), _slot_count(0), _shift(0), _size(0), _growth_limit(0), _max_load(obj._max_load),
+                  _hash(obj._hash), _equal(obj._equal), _value_alloc(obj._value_alloc), _control_alloc(obj._control_alloc)
+            {
+                this->swap(obj);
+            }
+            hash_table& operator=(hash_table&& obj)
+            {
+                if (this != &obj)
+                {
+                    hash_table tmp(std::move(obj));
+                    this->swap(tmp);
+                }
+                return *this;
+            }
+#endif
+
+            iterator begin()
+            {
+                if (_size == 0)
+                    return this->end();
+                iterator it(_control, _slots);
+                if (*_control == hash_control::empty)
+                    ++it;
+                return it;
+            }
+            const_iterator begin() const { return const_cast<hash_table*>(this)->begin(); }
+            iterator end() { return iterator(_control + _slot_count, _slots + _slot_count); }
+            const_iterator end() const { return const_iterator(_control + _slot_count, _slots + _slot_count); }
+
+            bool empty() const { return _size == 0; }
+            size_type size() const { return _size; }
+            size_type max_size() const { return _value_alloc.max_size(); }
+
+            ft::pair<iterator, bool> insert(const value_type& val)
+            {
+                if (_capacity == 0)
+                    this->rehash_to(min_capacity);
+                size_type mixed = mix(_hash(val));
+                ft::pair<size_type, bool> found = this->probe(val, mixed);
+                if (found.second)
+                    return ft::make_pair(this->iterator_at(found.first), false);
+                // 자리가 없거나 너무 찼으면 늘린 뒤에 빈 자리를 다시 찾는다. (이미 없다는 것은 확인했으므로 비교는 하지 않는다)
+                if (found.first == _slot_count || _size >= _growth_limit)
+                {
+                    this->rehash_to(_capacity * 2);
+                    found.first = this->find_empty(_control, _slot_count, mixed >> _shift);
+                    while (found.first == _slot_count)
+                    {
+                        this->rehash_to(_capacity * 2);
+                        found.first = this->find_empty(_control, _slot_count, mixed >> _shift);
+                    }
+                }
+                _value_alloc.construct(_slots + found.first, val);
+                _control[found.first] = this->h2(mixed);
+                ++_size;
+                return ft::make_pair(this->iterator_at(found.first), true);
+            }
+
+            // 자리는 hash가 정하므로 hint는 쓰지 않는다.
+            iterator insert(const_iterator, const value_type& val) { return this->insert(val).first; }
+
+            template<typename InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                    this->insert(*first);
+            }
+
+            // 다음 값의 iterator. 뒤에 있던 값이 position 자리로 당겨졌으면 position이 그대로 다음 값이다.
+            iterator erase(const_iterator position)
+            {
+                size_type i = position.base() - _slots;
+                this->erase_at(i);
+                return this->next_from(i);
+            }
+
+            iterator erase(iterator position) { return this->erase(const_iterator(position)); }
+
+            template <typename Key>
+            size_type erase(const Key& key)
+            {
+                if (_size == 0)
+                    return 0;
+                ft::pair<size_type, bool> found = this->probe(key, mix(_hash(key)));
+                if (!found.second)
+                    return 0;
+                this->erase_at(found.first);
+                return 1;
+            }
+
+            // 범위 안의 값을 모두 비운 다음, 바로 뒤에 이어지는 값들을 home부터 다시 넣는다.
+            // 하나씩 erase하면 뒤에서 당겨진 값이 범위 안으로 들어와 같이 지워질 수 있다.
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                if (first == last)
+                    return this->iterator_at(last.base() - _slots);
+                if (first == this->begin() && last == this->end())
+                {
+                    this->clear();
+                    return this->end();
+                }
+                size_type from = first.base() - _slots;
+                size_type to = last.base() - _slots;
+                for (size_type i = from; i < to; i++)
+                {
+                    if (_control[i] != hash_control::empty)
+                    {
+                        _value_alloc.destroy(_slots + i);
+                        _control[i] = hash_control::empty;
+                        --_size;
+                    }
+                }
+                for (size_type j = to; j < _slot_count && _control[j] != hash_control::empty; j++)
+                {
+                    size_type home = mix(_hash(_slots[j])) >> _shift;
+                    size_type i = this->find_empty(_control, _slot_count, home);
+                    if (i < j)
+                    {
+                        this->relocate(_slots + i, _slots + j);
+                        _control[i] = _control[j];
+                        _control[j] = hash_control::empty;
+                    }
+                }
+                return this->next_from(from);
+            }
+
+            void swap(hash_table& t)
+            {
+                ft::swap(this->_control, t._control);
+                ft::swap(this->_slots, t._slots);
+                ft::swap(this->_capacity, t._capacity);
+                ft::swap(this->_slot_count, t._slot_count);
+                ft::swap(this->_shift, t._shift);
+                ft::swap(this->_size, t._size);
+                ft::swap(this->_growth_limit, t._growth_limit);
+                ft::swap(this->_max_load, t._max_load);
+                ft::swap(this->_hash, t._hash);
+                ft::swap(this->_equal, t._equal);
+                ft::swap(this->_value_alloc, t._value_alloc);
+                ft::swap(this->_control_alloc, t._control_alloc);
+            }
+
+            // 값만 지우고 배열은 남겨 둔다.
+            void clear()
+            {
+                if (_size == 0)
+                    return ;
+                for (size_type i = 0; i < _slot_count; i++)
+                    if (_control[i] != hash_control::empty)
+                        _value_alloc.destroy(_slots + i);
+                std::memset(_control, hash_control::empty, _slot_count);
+                _size = 0;
+            }
+
+            template <typename Key>
+            iterator find(const Key& key)
+            {
+                if (_size == 0)
+                    return this->end();
+                ft::pair<size_type, bool> found = this->probe(key, mix(_hash(key)));
+                return found.second ? this->iterator_at(found.first) : this->end();
+            }
+
+            template <typename Key>
+            const_iterator find(const Key& key) const { return const_cast<hash_table*>(this)->find(key); }
+
+            template <typename Key>
+            size_type count(const Key& key) const { return this->find(key) != this->end(); }
+
+            template <typename Key>
+            ft::pair<iterator, iterator> equal_range(const Key& key)
+            {
+                iterator first = this->find(key);
+                iterator last = first;
+                if (first != this->end())
+                    ++last;
+                return ft::make_pair(first, last);
+            }
+
+            template <typename Key>
+            ft::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+            {
+                ft::pair<iterator, iterator> range = const_cast<hash_table*>(this)->equal_range(key);
+                return ft::make_pair(const_iterator(range.first), const_iterator(range.second));
+            }
+
+            // ==============================================Buckets==============================================
+            // bucket은 home이 될 수 있는 slot 하나다.
+            size_type bucket_count() const { return _capacity; }
+            float load_factor() const { return _capacity ? static_cast<float>(_size) / _capacity : 0.0f; }
+            float max_load_factor() const { return _max_load; }
+            void max_load_factor(float ml)
+            {
+                if (ml <= 0.0f || ml > 1.0f)
+                    return ;
+                _max_load = ml;
+                _growth_limit = static_cast<size_type>(_capacity * _max_load);
+                if (_size > _growth_limit)
+                    this->rehash(0);
+            }
+
+            // bucket을 n개 이상, 지금 값들이 max_load_factor를 넘지 않을 만큼으로 맞춘다.
+            void rehash(size_type n)
+            {
+                size_type need = static_cast<size_type>(_size / _max_load) + 1;
+                if (n < need)
+                    n = need;
+                size_type capacity = min_capacity;
+                while (capacity < n)
+                    capacity *= 2;
+                if (capacity != _capacity)
+                    this->rehash_to(capacity);
+            }
+
+            // n개를 넣을 때까지 rehash가 일어나지 않게 한다.
+            void reserve(size_type n) { this->rehash(static_cast<size_type>(n / _max_load) + 1); }
+
+            value_hash hash_function() const { return _hash; }
+            value_equal value_eq() const { return _equal; }
+            allocator_type get_allocator() const { return _value_alloc; }
+
+        private:
+            // 곱셈으로 hash의 모든 bit를 위쪽 bit로 모은다. home과 h2는 위쪽 bit에서 가져온다. (fibonacci hashing)
+            static size_type mix(size_type h)
+            {
+#if ULONG_MAX > 0xFFFFFFFFUL
+                return h * static_cast<size_type>(0x9E3779B97F4A7C15UL);
+#else
+                return h * static_cast<size_type>(0x9E3779B9UL);
+#endif
+            }
+
+            // home으로 쓴 bit 바로 아래의 7 bit
+            signed char h2(size_type mixed) const { return static_cast<signed char>((mixed >> (_shift - 7)) & 0x7F); }
+
+            iterator iterator_at(size_type i) { return iterator(_control + i, _slots + i); }
+
+            // i부터 처음 값이 있는 slot (없으면 end)
+            iterator next_from(size_type i)
+            {
+                iterator it = this->iterator_at(i);
+                if (_control[i] == hash_control::empty)
+                    ++it;
+                return it;
+            }
+
+            // first: key가 있으면 그 slot, 없으면 key가 들어갈 빈 slot. 빈 slot도 없으면 _slot_count
+            template <typename Key>
+            ft::pair<size_type, bool> probe(const Key& key, size_type mixed) const
+            {
+                signed char tag = this->h2(mixed);
+                size_type home = mixed >> _shift;
+                size_type group = home & ~(group_width - 1);
+                unsigned skip = ~0u << (home - group);  // 첫 group에서는 home 앞의 slot을 보지 않는다.
+
+                for (; group < _slot_count; group += group_width, skip = ~0u)
+                {
+                    hash_group g(_control + group);
+                    unsigned empty = g.match_empty() & skip;
+                    // 빈 slot 뒤에 있는 slot은 이 key의 자리가 아니다.
+                    unsigned before_empty = empty ? (empty & (0u - empty)) - 1 : ~0u;
+                    for (unsigned match = g.match(tag) & skip & before_empty; match; match &= match - 1)
+                    {
+                        size_type i = group + hash_first_bit(match);
+                        if (_equal(_slots[i], key))
+                            return ft::make_pair(i, true);
+                    }
+                    if (empty)
+                        return ft::make_pair(group + hash_first_bit(empty), false);
+                }
+                return ft::make_pair(_slot_count, false);
+            }
+
+            // home부터 처음 만나는 빈 slot. 없으면 slot_count
+            static size_type find_empty(const signed char* control, size_type slot_count, size_type home)
+            {
+                size_type group = home & ~(group_width - 1);
+                unsigned skip = ~0u << (home - group);
+
+                for (; group < slot_count; group += group_width, skip = ~0u)
+                {
+                    unsigned empty = hash_group(control + group).match_empty() & skip;
+                    if (empty)
+                        return group + hash_first_bit(empty);
+                }
+                return slot_count;
+            }
+
+            // slot i를 비우고, 뒤에 이어진 값 중 home이 빈 자리 이전인 값을 당겨 온다.
+            void erase_at(size_type i)
+            {
+                _value_alloc.destroy(_slots + i);
+                _control[i] = hash_control::empty;
+                --_size;
+
+                size_type hole = i;
+                for (size_type j = i + 1; j < _slot_count && _control[j] != hash_control::empty; j++)
+                {
+                    size_type home = mix(_hash(_slots[j])) >> _shift;
+                    if (home <= hole)
+                    {
+                        this->relocate(_slots + hole, _slots + j);
+                        _control[hole] = _control[j];
+                        _control[j] = hash_control::empty;
+                        hole = j;
+                    }
+                }
+            }
+
+            // 값 하나를 빈 slot dst로 옮긴다. src는 소멸된 상태가 된다.
+            void relocate(pointer dst, pointer src) { this->relocate(dst, src, typename ft::is_trivially_relocatable<value_type>::type()); }
+            void relocate(pointer dst, pointer src, ft::true_type)
+            {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(value_type));
+            }
+            void relocate(pointer dst, pointer src, ft::false_type)
+            {
+                _value_alloc.construct(dst, FT_MOVE(*src));
+                _value_alloc.destroy(src);
+            }
+
+            void allocate(size_type slot_count, signed char*& control, pointer& slots)
+            {
+                control = _control_alloc.allocate(slot_count + 1);
+                try
+                {
+                    slots = _value_alloc.allocate(slot_count);
+                }
+                catch (...)
+                {
+                    _control_alloc.deallocate(control, slot_count + 1);
+                    throw;
+                }
+                std::memset(control, hash_control::empty, slot_count);
+                control[slot_count] = hash_control::end;
+            }
+
+            void deallocate(signed char* control, pointer slots, size_type slot_count)
+            {
+                if (control == NULL)
+                    return ;
+                _control_alloc.deallocate(control, slot_count + 1);
+                _value_alloc.deallocate(slots, slot_count);
+            }
+
+            static int shift_for(size_type capacity)
+            {
+                int shift = static_cast<int>(sizeof(size_type) * CHAR_BIT);
+                for (; capacity > 1; capacity >>= 1)
+                    shift--;
+                return shift;
+            }
+
+            // capacity로 새 배열을 만들어 값을 옮긴다. 새 배열의 끝에서 넘치면 두 배로 다시 한다.
+            void rehash_to(size_type capacity)
+            {
+                while (!this->try_rehash_to(capacity, typename ft::is_trivially_relocatable<value_type>::type()))
+                    capacity *= 2;
+            }
+
+            // trivially relocatable이면 bit만 복사하고, 다 옮긴 뒤에 예전 배열을 소멸자 없이 돌려준다.
+            // 넘쳐서 실패하면 새 배열만 버린다. (예전 값은 그대로 남아 있다)
+            bool try_rehash_to(size_type capacity, ft::true_type)
+            {
+                size_type slot_count = capacity + group_width;
+                int shift = shift_for(capacity);
+                signed char* control;
+                pointer slots;
+
+                this->allocate(slot_count, control, slots);
+                for (size_type i = 0; i < _slot_count; i++)
+                {
+                    if (_control[i] == hash_control::empty)
+                        continue;
+                    size_type mixed = mix(_hash(_slots[i]));
+                    size_type j = find_empty(control, slot_count, mixed >> shift);
+                    if (j == slot_count)
+                    {
+                        this->deallocate(control, slots, slot_count);
+                        return false;
+                    }
+                    std::memcpy(static_cast<void*>(slots + j), static_cast<const void*>(_slots + i), sizeof(value_type));
+                    control[j] = static_cast<signed char>((mixed >> (shift - 7)) & 0x7F);
+                }
+                this->deallocate(_control, _slots, _slot_count);
+                this->adopt(control, slots, capacity, shift);
+                return true;
+            }
+
+            // 그 밖의 타입은 복사해서 넣고, 다 성공한 뒤에 예전 값을 지운다. 복사 중 예외가 나도 예전 상태가 남는다.
+            bool try_rehash_to(size_type capacity, ft::false_type)
+            {
+                size_type slot_count = capacity + group_width;
+                int shift = shift_for(capacity);
+                signed char* control;
+                pointer slots;
+                bool overflow = false;
+
+                this->allocate(slot_count, control, slots);
+                try
+                {
+                    for (size_type i = 0; i < _slot_count && !overflow; i++)
+                    {
+                        if (_control[i] == hash_control::empty)
+                            continue;
+                        size_type mixed = mix(_hash(_slots[i]));
+                        size_type j = find_empty(control, slot_count, mixed >> shift);
+                        if (j == slot_count)
+                            overflow = true;
+                        else
+                        {
+                            _value_alloc.construct(slots + j, _slots[i]);
+                            control[j] = static_cast<signed char>((mixed >> (shift - 7)) & 0x7F);
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    this->destroy_all(control, slots, slot_count);
+                    throw;
+                }
+                if (overflow)
+                {
+                    this->destroy_all(control, slots, slot_count);
+                    return false;
+                }
+                size_type size = _size;
+                this->clear();
+                this->deallocate(_control, _slots, _slot_count);
+                this->adopt(control, slots, capacity, shift);
+                _size = size;
+                return true;
+            }
+
+            void destroy_all(signed char* control, pointer slots, size_type slot_count)
+            {
+                for (size_type i = 0; i < slot_count; i++)
+                    if (control[i] != hash_control::empty)
+                        _value_alloc.destroy(slots + i);
+                this->deallocate(control, slots, slot_count);
+            }
+
+            // rehash_to가 만든 배열로 바꾼다. _size는 그대로다.
+            void adopt(signed char* control, pointer slots, size_type capacity, int shift)
+            {
+                _control = control;
+                _slots = slots;
+                _capacity = capacity;
+                _slot_count = capacity + group_width;
+                _shift = shift;
+                _growth_limit = static_cast<size_type>(capacity * _max_load);
+            }
+
+            // 같은 크기의 배열에 같은 자리로 복사한다.
+            void copy_from(const hash_table& obj)
+            {
+                if (obj._size == 0)
+                    return ;
+                size_type slot_count = obj._slot_count;
+                signed char* control;
+                pointer slots;
+
+                this->allocate(slot_count, control, slots);
+                size_type i = 0;
+                try
+                {
+                    for (; i < slot_count; i++)
+                        if (obj._control[i] != hash_control::empty)
+                            _value_alloc.construct(slots + i, obj._slots[i]);
+                }
+                catch (...)
+                {
+                    while (i-- > 0)
+                        if (obj._control[i] != hash_control::empty)
+                            _value_alloc.destroy(slots + i);
+                    this->deallocate(control, slots, slot_count);
+                    throw;
+                }
+                std::memcpy(control, obj._control, slot_count);
+                _size = obj._size;
+                this->adopt(control, slots, obj._capacity, obj._shift);
+            }
+    };
+}
+
+#endif
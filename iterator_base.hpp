@@ -2,14 +2,18 @@
 #define ITERATOR_BASE_HPP
 
 #include <cstddef>
+#include <iterator>
 
 namespace ft
 {
-    struct input_iterator_tag {};
-    struct output_iterator_tag {};
-    struct foward_iterator_tag : public input_iterator_tag, output_iterator_tag {};
-    struct bidirectional_iterator_tag : public foward_iterator_tag {};
-    struct random_access_iterator_tag : public bidirectional_iterator_tag {};
+    // std의 tag를 그대로 쓰면 std 컨테이너의 반복자(std::vector<T>::iterator 등)도
+    // ft의 iterator_category 분기(tag dispatch)를 그대로 탈 수 있다.
+    typedef std::input_iterator_tag             input_iterator_tag;
+    typedef std::output_iterator_tag            output_iterator_tag;
+    typedef std::forward_iterator_tag           forward_iterator_tag;
+    typedef std::forward_iterator_tag           foward_iterator_tag;
+    typedef std::bidirectional_iterator_tag     bidirectional_iterator_tag;
+    typedef std::random_access_iterator_tag     random_access_iterator_tag;
 
 
     template < typename Category, typename T, typename Distance = std::ptrdiff_t, typename Pointer = T*, typename Reference = T& >
@@ -20,7 +20,7 @@ namespace ft
             typedef typename allocator_type::const_pointer                              const_pointer;
             typedef typename std::ptrdiff_t                                             difference_type;
             typedef typename std::size_t                                                size_type;
-            class value_compare : public std::binary_function<value_type, value_type, bool>
+            class value_compare
             {
                 friend class		map;
             
@@ -33,6 +33,27 @@ namespace ft
                     typedef value_type second_argument_type;
                     bool operator()(const value_type& x, const value_type& y) const
                     { return comp(x.first, y.first); }
+
+                    // key만으로 검색할 때는 value를 만들지 않고 key와 바로 비교한다.
+                    bool operator()(const value_type& x, const key_type& k) const
+                    { return comp(x.first, k); }
+                    bool operator()(const key_type& k, const value_type& y) const
+                    { return comp(k, y.first); }
+
+                    // range insert로 들어온 다른 pair 타입(ft::pair<Key, T> 등)도 value_type으로 바꾸지 않고 비교한다.
+                    template <typename U1, typename V1, typename U2, typename V2>
+                    bool operator()(const ft::pair<U1, V1>& x, const ft::pair<U2, V2>& y) const
+                    { return comp(x.first, y.first); }
+
+                    // key_compare가 transparent면 key_type이 아닌 타입으로도 검색할 수 있다.
+                    template <typename K>
+                    typename ft::enable_if<ft::is_transparent<key_compare>::value && !ft::is_pair<K>::value, bool>::type
+                    operator()(const value_type& x, const K& k) const
+                    { return comp(x.first, k); }
+                    template <typename K>
+                    typename ft::enable_if<ft::is_transparent<key_compare>::value && !ft::is_pair<K>::value, bool>::type
+                    operator()(const K& k, const value_type& y) const
+                    { return comp(k, y.first); }
             };
             typedef typename ft::rb_tree<value_type, value_compare, allocator_type>     tree_type;
             typedef typename tree_type::iterator                                        iterator;
@@ -66,6 +87,14 @@ namespace ft
                     _tree = x._tree;
                 return (*this);
             }
+#if __cplusplus >= 201103L
+            map (map&& x): _tree(std::move(x._tree)) {}
+            map& operator= (map&& x)
+            {
+                _tree = std::move(x._tree);
+                return (*this);
+            }
+#endif
 
             // ============================================Iterators============================================
             iterator begin() { return (_tree.begin()); }
@@ -79,50 +108,126 @@ namespace ft
 
             // =============================================Capacity=============================================
             bool empty() const { return (_tree.empty()); }
+            // O(1), except the first call after split or join without FT_RB_TREE_ORDER_STATISTICS (see split).
             size_type size() const { return (_tree.size()); }
             size_type max_size() const { return (_tree.max_size()); }
 
             // ===========================================Element access===========================================
+            // 이미 있는 key라면 mapped_type을 만들지 않는다.
+            // 없을 때는 lower_bound 위치가 새 노드 자리이므로 hint로 넘겨서 다시 내려가지 않게 한다.
             mapped_type& operator[](const key_type& k) 
-            { return (*((this->insert(ft::make_pair(k, mapped_type()))).first)).second; }
+            {
+                iterator it = this->lower_bound(k);
+                if (it == this->end() || _tree.value_comp()(k, *it))
+                    it = _tree.insert(it, value_type(k, mapped_type()));
+                return (*it).second;
+            }
+#if __cplusplus >= 201103L
+            // 없는 key라면 k를 옮겨서 새 노드의 key로 쓴다.
+            mapped_type& operator[](key_type&& k)
+            {
+                iterator it = this->lower_bound(k);
+                if (it == this->end() || _tree.value_comp()(k, *it))
+                    it = _tree.emplace_hint(it, std::move(k), mapped_type());
+                return (*it).second;
+            }
+#endif
 
             // =============================================Modifiers=============================================
             ft::pair<iterator, bool> insert(const value_type& x) { return (_tree.insert(x)); }
             iterator insert(iterator position, const value_type& x) { return (_tree.insert(position, x)); }
+#if __cplusplus >= 201103L
+            ft::pair<iterator, bool> insert(value_type&& x) { return (_tree.insert(std::move(x))); }
+            iterator insert(iterator position, value_type&& x) { return (_tree.insert(position, std::move(x))); }
+            // 같은 key가 이미 있으면 만든 값은 버린다.
+            template <typename... Args>
+            ft::pair<iterator, bool> emplace(Args&&... args) { return (_tree.emplace(std::forward<Args>(args)...)); }
+            template <typename... Args>
+            iterator emplace_hint(iterator position, Args&&... args) { return (_tree.emplace_hint(position, std::forward<Args>(args)...)); }
+#endif
             template <typename InputIterator>
             void insert(InputIterator first, InputIterator last) { return (_tree.insert(first, last)); }
             void erase(iterator position) { return (_tree.erase(position)); }
-            size_type erase(const key_type& x) { return (_tree.erase(ft::make_pair(x, mapped_type()))); }
+            size_type erase(const key_type& x) { return (_tree.erase(x)); }
+            // Removes the elements in [first, last). O(log n + k) for k removed elements: the tree is split and rejoined
+            // in O(log n), and each removed element still has to be destroyed.
             void erase(iterator first, iterator last) { _tree.erase(first, last); }
+            // Removes all elements for which pred(element) returns true and returns how many were removed.
+            // 남는 노드로 트리를 한 번에 다시 세우므로 O(n)이다.
+            template <typename Predicate>
+            size_type erase_if(Predicate pred) { return _tree.erase_if(pred); }
             void swap(map& x) { _tree.swap(x._tree); }
             void clear() { _tree.clear(); }
+            // Empties the map at once and frees the removed nodes over several calls. The first call takes every node out,
+            // so the map is empty (and usable) right away; each call then frees or unlinks at most budget nodes.
+            // Returns true when nothing is left to free.
+            // 큰 map을 한 번에 비우지 않고 여러 번에 나눠 비울 때 쓴다. (ft::reclaim은 reclaimer.hpp)
+            bool clear_some(size_type budget) { return _tree.clear_some(budget); }
+            // Moves every element whose key is not less than k into x, replacing the previous contents of x.
+            // O(log n). x takes the comparison object and allocator of the container, so the nodes are always handed over
+            // without copying or allocating, even with pool_allocator. Without FT_RB_TREE_ORDER_STATISTICS the sizes of the
+            // two parts are only counted right away when the cut is near either end; otherwise the first size() of each
+            // part counts its elements (linear in that part).
+            void split(const key_type& k, map& x) { _tree.split(k, x._tree); }
+            // Moves every element of x into the container and leaves x empty. Either all keys of x must be greater than
+            // all keys of the container or all less; otherwise std::invalid_argument is thrown and both are left unchanged.
+            // O(log n) when the allocators compare equal. If they compare unequal (pool_allocator) the nodes cannot change owner:
+            // the elements of x are copied into the container one by one, O(m log(n + m)) for m elements of x, and x is
+            // cleared afterwards. If a copy throws, the elements copied so far stay in the container and x is unchanged.
+            void join(map& x) { _tree.join(x._tree); }
+            // Replaces the contents with their union / intersection / difference / symmetric difference with x.
+            // When a key is in both, the element of this map is kept. Linear in size() + x.size(); when one side is
+            // at least 8 times smaller (m elements against n) its elements are looked up one by one instead, in O(m log n).
+            void merge_union(const map& x) { _tree.merge_union(x._tree); }
+            void merge_intersection(const map& x) { _tree.merge_intersection(x._tree); }
+            void merge_difference(const map& x) { _tree.merge_difference(x._tree); }
+            void merge_symmetric_difference(const map& x) { _tree.merge_symmetric_difference(x._tree); }
 
             // =============================================Observers=============================================
-            key_compare key_comp() const { return (key_compare()); }
+            key_compare key_comp() const { return (_tree.value_comp().comp); }
             value_compare value_comp() const { return (_tree.value_comp()); }
 
             // =============================================Operations=============================================
-            iterator find(const key_type& x)
-            { return (_tree.find(ft::make_pair(x, mapped_type()))); }
-            const_iterator find(const key_type& x) const
-            { return (_tree.find(ft::make_pair(x, mapped_type()))); }
+            iterator find(const key_type& x) { return (_tree.find(x)); }
+            const_iterator find(const key_type& x) const { return (_tree.find(x)); }
+            size_type count(const key_type& x) const { return (_tree.count(x)); }
+            iterator lower_bound(const key_type& x) { return (_tree.lower_bound(x)); }
+            const_iterator lower_bound(const key_type& x) const { return (_tree.lower_bound(x)); }
+            iterator upper_bound(const key_type& x) { return (_tree.upper_bound(x)); }
+            const_iterator upper_bound(const key_type& x) const { return (_tree.upper_bound(x)); }
+            ft::pair<iterator,iterator> equal_range(const key_type& x) { return (_tree.equal_range(x)); }
+            ft::pair<const_iterator,const_iterator> equal_range(const key_type& x) const { return (_tree.equal_range(x)); }
 
-            size_type count(const key_type& x) const
-            { return (_tree.count(ft::make_pair(x, mapped_type()))); }
-            
-            iterator lower_bound(const key_type& x)
-            { return (_tree.lower_bound(ft::make_pair(x, mapped_type()))); }
-            const_iterator lower_bound(const key_type& x) const
-            { return (_tree.lower_bound(ft::make_pair(x, mapped_type()))); }
-            iterator upper_bound(const key_type& x)
-            { return (_tree.upper_bound(ft::make_pair(x, mapped_type()))); }
-            const_iterator upper_bound(const key_type& x) const
-            { return (_tree.upper_bound(ft::make_pair(x, mapped_type()))); }
-            
-            ft::pair<iterator,iterator> equal_range(const key_type& x) 
-            { return (_tree.equal_range(ft::make_pair(x, mapped_type()))); }
-            ft::pair<const_iterator,const_iterator> equal_range(const key_type& x) const 
-            { return (_tree.equal_range(ft::make_pair(x, mapped_type()))); }
+            // transparent comparator(ft::less<> 등)일 때만 쓸 수 있는 key_type 이외의 타입으로 검색하는 overload
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type find(const K& x) { return (_tree.find(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type find(const K& x) const { return (_tree.find(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, size_type>::type count(const K& x) const { return (_tree.count(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type lower_bound(const K& x) { return (_tree.lower_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type lower_bound(const K& x) const { return (_tree.lower_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type upper_bound(const K& x) { return (_tree.upper_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type upper_bound(const K& x) const { return (_tree.upper_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, ft::pair<iterator, iterator> >::type equal_range(const K& x) { return (_tree.equal_range(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, ft::pair<const_iterator, const_iterator> >::type equal_range(const K& x) const { return (_tree.equal_range(x)); }
+
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+            // ==========================================Order statistics==========================================
+            // FT_RB_TREE_ORDER_STATISTICS로 컴파일했을 때만 있다. 모두 O(log n)
+            iterator select(size_type k) { return (_tree.select(k)); }
+            const_iterator select(size_type k) const { return (_tree.select(k)); }
+            size_type rank(const key_type& x) const { return (_tree.rank(x)); }
+            size_type count_range(const key_type& lo, const key_type& hi) const { return (_tree.count_range(lo, hi)); }
+            size_type index(const_iterator position) const { return (_tree.index(position)); }
+            difference_type distance(const_iterator first, const_iterator last) const { return (_tree.distance(first, last)); }
+#endif
 
             // =============================================Allocator=============================================
             allocator_type get_allocator() const { return _tree.get_allocator(); }
@@ -155,6 +260,9 @@ namespace ft
 
     template <class Key_, class T_, class Compare_, class Alloc>
     void swap(ft::map<Key_, T_, Compare_, Alloc>& x, ft::map<Key_, T_, Compare_, Alloc>& y) { x.swap(y); }
+
+    template <class Key_, class T_, class Compare_, class Alloc, class Predicate>
+    typename ft::map<Key_, T_, Compare_, Alloc>::size_type erase_if(ft::map<Key_, T_, Compare_, Alloc>& c, Predicate pred) { return c.erase_if(pred); }
 }
 
 #endif
\ No newline at end of file
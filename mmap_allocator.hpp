@@ -0,0 +1,130 @@
+#ifndef MMAP_ALLOCATOR_HPP
+#define MMAP_ALLOCATOR_HPP
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstddef>
+#include <new>
+#include "type_traits.hpp"
+
+// 이 크기(byte) 이상인 buffer만 mmap으로 받는다. 작은 buffer는 operator new가 더 싸다.
+#ifndef FT_MMAP_ALLOCATOR_THRESHOLD
+# define FT_MMAP_ALLOCATOR_THRESHOLD (1 << 20)
+#endif
+
+namespace ft
+{
+    // ==========================================mmap allocator==========================================
+    // 수백 MB 이상으로 커지는 vector를 위한 Linux 전용 allocator.
+    //   ft::vector<Buffer, ft::mmap_allocator<Buffer> >
+    // 큰 buffer를 익명 mmap으로 받고, reallocate()에서 mremap으로 page table만 옮겨서 크기를 늘린다.
+    // 원소를 복사하지 않으므로 예전 buffer와 새 buffer가 동시에 RSS에 올라오지 않는다.
+    // vector는 allocator_can_reallocate로 이 allocator를 알아보고, 원소가 trivially relocatable일 때만 reallocate()를 쓴다.
+    // HugePages가 true면 mmap한 구간에 madvise(MADV_HUGEPAGE)로 transparent huge page를 요청한다.
+    template <typename T, bool HugePages = false>
+    class mmap_allocator
+    {
+        public:
+            typedef T                   value_type;
+            typedef T*                  pointer;
+            typedef const T*            const_pointer;
+            typedef T&                  reference;
+            typedef const T&            const_reference;
+            typedef std::size_t         size_type;
+            typedef std::ptrdiff_t      difference_type;
+
+            template <typename U>
+            struct rebind { typedef mmap_allocator<U, HugePages> other; };
+
+        public:
+            mmap_allocator() {}
+            mmap_allocator(const mmap_allocator&) {}
+            template <typename U>
+            mmap_allocator(const mmap_allocator<U, HugePages>&) {}
+            ~mmap_allocator() {}
+
+            pointer address(reference x) const { return &x; }
+            const_pointer address(const_reference x) const { return &x; }
+
+            pointer allocate(size_type n, const void* hint = 0)
+            {
+                (void)hint;
+                if (n > this->max_size())
+                    throw std::bad_alloc();
+                if (!is_mapped(n))
+                    return static_cast<pointer>(::operator new(n * sizeof(T)));
+                void* p = mmap(NULL, mapped_bytes(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (p == MAP_FAILED)
+                    throw std::bad_alloc();
+                advise(p, mapped_bytes(n));
+                return static_cast<pointer>(p);
+            }
+
+            void deallocate(pointer p, size_type n)
+            {
+                if (is_mapped(n))
+                    munmap(static_cast<void*>(p), mapped_bytes(n));
+                else
+                    ::operator delete(p);
+            }
+
+            // old_n개짜리 buffer p를 new_n개짜리로 바꾼 주소를 돌려준다. 내용은 byte 그대로 옮겨지므로
+            // trivially relocatable한 원소만 들어 있어야 한다. 옮길 수 없으면 0을 돌려주고 p는 그대로 남는다.
+            pointer reallocate(pointer p, size_type old_n, size_type new_n)
+            {
+#ifdef MREMAP_MAYMOVE
+                if (p == 0 || !is_mapped(old_n) || !is_mapped(new_n) || new_n > this->max_size())
+                    return 0;
+                void* q = mremap(static_cast<void*>(p), mapped_bytes(old_n), mapped_bytes(new_n), MREMAP_MAYMOVE);
+                if (q == MAP_FAILED)
+                    return 0;
+                advise(q, mapped_bytes(new_n));
+                return static_cast<pointer>(q);
+#else
+                (void)p; (void)old_n; (void)new_n;
+                return 0;
+#endif
+            }
+
+            size_type max_size() const { return size_type(-1) / 2 / sizeof(T); }
+#if __cplusplus >= 201103L
+            template <typename U, typename... Args>
+            void construct(U* p, Args&&... args) { new (static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+#else
+            void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) T(val); }
+#endif
+            void destroy(pointer p) { p->~T(); }
+
+            // 상태가 없으므로 어느 allocator로 받은 buffer든 다른 allocator로 돌려줄 수 있다.
+            bool operator==(const mmap_allocator&) const { return true; }
+            bool operator!=(const mmap_allocator&) const { return false; }
+
+        private:
+            static bool is_mapped(size_type n) { return n * sizeof(T) >= FT_MMAP_ALLOCATOR_THRESHOLD; }
+
+            static std::size_t mapped_bytes(size_type n)
+            {
+                static const std::size_t page = sysconf(_SC_PAGESIZE);
+                return (n * sizeof(T) + page - 1) / page * page;
+            }
+
+            static void advise(void* p, std::size_t bytes)
+            {
+#ifdef MADV_HUGEPAGE
+                if (HugePages)
+                    madvise(p, bytes, MADV_HUGEPAGE);
+#else
+                (void)p; (void)bytes;
+#endif
+            }
+    };
+
+    template <typename T, bool HugePages>
+    struct allocator_can_reallocate<ft::mmap_allocator<T, HugePages> > : public true_type {};
+
+    // 상태가 없고 mmap/operator new만 부르므로 thread 사이에 같이 써도 된다.
+    template <typename T, bool HugePages>
+    struct allocator_is_thread_safe<ft::mmap_allocator<T, HugePages> > : public true_type {};
+}
+
+#endif
@@ -1,6 +1,12 @@
 #ifndef PAIR_HPP
 #define PAIR_HPP
 
+#include "type_traits.hpp"
+
+#if __cplusplus >= 201103L
+# include <type_traits>
+#endif
+
 namespace ft
 {
     template <class T1, class T2>
@@ -34,12 +40,30 @@ namespace ft
             second = pr.second;
             return *this;
         }
+
+#if __cplusplus >= 201103L
+        // (4) move constructor / forwarding constructor (C++11)
+        // map의 emplace와 operator[]가 key와 값을 옮겨서 만들 수 있게 한다.
+        pair (const pair&) = default;
+        pair (pair&&) = default;
+        template<class U, class V>
+        pair (U&& a, V&& b): first(std::forward<U>(a)), second(std::forward<V>(b)) {}
+        template<class U, class V>
+        pair (pair<U,V>&& pr): first(std::forward<U>(pr.first)), second(std::forward<V>(pr.second)) {}
+
+        pair& operator= (pair&& pr)
+        {
+            first = std::move(pr.first);
+            second = std::move(pr.second);
+            return *this;
+        }
+#endif
     };
     // relational operators (pair)
     template <class T1, class T2>  bool operator== (const pair<T1,T2>& lhs, const pair<T1,T2>& rhs)
     { return lhs.first == rhs.first && lhs.second == rhs.second; }
     template <class T1, class T2>  bool operator!= (const pair<T1,T2>& lhs, const pair<T1,T2>& rhs)
-    { return !(lhs = rhs); }
+    { return !(lhs == rhs); }
     template <class T1, class T2>  bool operator<  (const pair<T1,T2>& lhs, const pair<T1,T2>& rhs)
     { return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second); }
     template <class T1, class T2>  bool operator<= (const pair<T1,T2>& lhs, const pair<T1,T2>& rhs)
@@ -49,9 +73,27 @@ namespace ft
     template <class T1, class T2>  bool operator>= (const pair<T1,T2>& lhs, const pair<T1,T2>& rhs)
     { return !(lhs < rhs); }
 
+#if __cplusplus >= 201103L
+    // 인자를 그대로 전달하므로 옮길 수만 있는 값(std::unique_ptr 등)도 pair로 만들 수 있다.
+    template <typename T1, typename T2>
+    inline ft::pair<typename std::decay<T1>::type, typename std::decay<T2>::type> make_pair(T1&& first, T2&& second)
+    { return ft::pair<typename std::decay<T1>::type, typename std::decay<T2>::type>(std::forward<T1>(first), std::forward<T2>(second)); }
+#else
     template <typename T1, typename T2>
 	inline ft::pair<T1, T2> make_pair(T1 first, T2 second)
 	{ return ft::pair<T1, T2>(first, second); }
+#endif
+
+    template <typename T>
+    struct is_pair : public false_type {};
+
+    template <typename T1, typename T2>
+    struct is_pair<ft::pair<T1, T2> > : public true_type {};
+
+    // 두 멤버가 모두 memmove로 옮길 수 있으면 pair도 그렇다. (map/btree_map의 value_type)
+    template <typename T1, typename T2>
+    struct is_trivially_relocatable<ft::pair<T1, T2> >
+        : public bool_type<is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value> {};
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,211 @@
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace ft
+{
+    // ============================================node pool============================================
+    // 크기가 같은 객체를 slab(큰 메모리 덩어리) 단위로 잘라서 나눠준다.
+    // 반납된 객체는 자기 자리를 next 포인터로 써서 free list에 쌓이고(intrusive free list),
+    // 살아있는 객체가 하나도 없게 되면 slab 전체를 한 번에 돌려준다.
+    // 여러 스레드에서 동시에 쓰면 안 된다.
+    class node_pool
+    {
+        private:
+            struct free_node { free_node* next; };
+            struct slab { slab* next; };
+
+            // slab 앞에 붙는 header 크기. operator new가 주는 정렬(16 byte)을 그대로 유지하기 위해 16의 배수로 둔다.
+            static const std::size_t header_size = (sizeof(slab) + 15) / 16 * 16;
+            static const std::size_t slab_bytes = 64 * 1024;
+
+            std::size_t _object_size;
+            std::size_t _objects_per_slab;
+            slab*       _slabs;
+            free_node*  _free;
+            char*       _bump;          // 가장 최근 slab에서 아직 잘라주지 않은 부분
+            char*       _bump_end;
+            std::size_t _live;
+            std::size_t _refs;
+
+            node_pool(const node_pool&);
+            node_pool& operator=(const node_pool&);
+
+            void add_slab()
+            {
+                char* memory = static_cast<char*>(::operator new(header_size + _object_size * _objects_per_slab));
+                slab* new_slab = reinterpret_cast<slab*>(memory);
+                new_slab->next = _slabs;
+                _slabs = new_slab;
+                _bump = memory + header_size;
+                _bump_end = _bump + _object_size * _objects_per_slab;
+            }
+
+        public:
+            node_pool(std::size_t object_size, std::size_t alignment)
+                : _object_size(object_size), _objects_per_slab(), _slabs(NULL), _free(NULL), _bump(NULL), _bump_end(NULL), _live(0), _refs(1)
+            {
+                if (_object_size < sizeof(free_node))
+                    _object_size = sizeof(free_node);
+                if (alignment < sizeof(free_node*))
+                    alignment = sizeof(free_node*);
+                _object_size = (_object_size + alignment - 1) / alignment * alignment;
+                _objects_per_slab = (slab_bytes - header_size) / _object_size;
+                if (_objects_per_slab < 16)
+                    _objects_per_slab = 16;
+            }
+
+            ~node_pool() { this->release(); }
+
+            void* allocate()
+            {
+                void* p;
+                if (_free != NULL)
+                {
+                    p = _free;
+                    _free = _free->next;
+                }
+                else
+                {
+                    if (_bump == _bump_end)
+                        this->add_slab();
+                    p = _bump;
+                    _bump += _object_size;
+                }
+                ++_live;
+                return p;
+            }
+
+            void deallocate(void* p)
+            {
+                free_node* node = static_cast<free_node*>(p);
+                node->next = _free;
+                _free = node;
+                if (--_live == 0)
+                    this->reset();
+            }
+
+            // 가장 최근 slab 하나만 남기고 나머지를 돌려준다.
+            // 노드 하나를 넣고 빼기를 반복할 때 매번 slab을 새로 받지 않기 위해서다.
+            void reset()
+            {
+                if (_slabs == NULL)
+                    return ;
+                slab* kept = _slabs;
+                _slabs = _slabs->next;
+                this->release();
+                kept->next = NULL;
+                _slabs = kept;
+                _bump = reinterpret_cast<char*>(kept) + header_size;
+                _bump_end = _bump + _object_size * _objects_per_slab;
+            }
+
+            // 모든 slab을 돌려준다. 살아있는 객체가 없을 때만 불러야 한다.
+            void release()
+            {
+                while (_slabs != NULL)
+                {
+                    slab* next = _slabs->next;
+                    ::operator delete(_slabs);
+                    _slabs = next;
+                }
+                _free = NULL;
+                _bump = NULL;
+                _bump_end = NULL;
+            }
+
+            void retain() { ++_refs; }
+            bool drop() { return --_refs == 0; }
+            std::size_t object_size() const { return _object_size; }
+    };
+
+    // T의 정렬 크기 (C++98에는 alignof가 없어서 char 뒤에 T를 놓았을 때 밀려나는 만큼으로 구한다)
+    template <typename T>
+    struct alignment_of
+    {
+        struct padded { char c; T t; };
+        static const std::size_t value = sizeof(padded) - sizeof(T);
+    };
+
+    // ==========================================pool allocator==========================================
+    // 한 번에 객체 하나씩 할당하는 노드 기반 컨테이너(map, set)를 위한 allocator.
+    //   ft::map<int, int, std::less<int>, ft::pool_allocator<ft::pair<const int, int> > >
+    // allocate(1)은 pool에서, 그보다 큰 요청은 operator new에서 받는다.
+    // 복사본끼리는 같은 pool을 공유하고(참조 카운트), rebind로 만든 allocator는 그 타입 크기의 pool을 새로 만든다.
+    template <typename T>
+    class pool_allocator
+    {
+        public:
+            typedef T                   value_type;
+            typedef T*                  pointer;
+            typedef const T*            const_pointer;
+            typedef T&                  reference;
+            typedef const T&            const_reference;
+            typedef std::size_t         size_type;
+            typedef std::ptrdiff_t      difference_type;
+
+            template <typename U>
+            struct rebind { typedef pool_allocator<U> other; };
+
+        private:
+            node_pool*  _pool;
+
+            template <typename U>
+            friend class pool_allocator;
+
+        public:
+            pool_allocator(): _pool(new node_pool(sizeof(T), ft::alignment_of<T>::value)) {}
+            pool_allocator(const pool_allocator& alloc): _pool(alloc._pool) { _pool->retain(); }
+            template <typename U>
+            pool_allocator(const pool_allocator<U>&): _pool(new node_pool(sizeof(T), ft::alignment_of<T>::value)) {}
+            ~pool_allocator()
+            {
+                if (_pool->drop())
+                    delete _pool;
+            }
+            pool_allocator& operator=(const pool_allocator& alloc)
+            {
+                alloc._pool->retain();
+                if (_pool->drop())
+                    delete _pool;
+                _pool = alloc._pool;
+                return *this;
+            }
+
+            pointer address(reference x) const { return &x; }
+            const_pointer address(const_reference x) const { return &x; }
+
+            pointer allocate(size_type n, const void* hint = 0)
+            {
+                (void)hint;
+                if (n == 1)
+                    return static_cast<pointer>(_pool->allocate());
+                return static_cast<pointer>(::operator new(n * sizeof(T)));
+            }
+
+            void deallocate(pointer p, size_type n)
+            {
+                if (n == 1)
+                    _pool->deallocate(p);
+                else
+                    ::operator delete(p);
+            }
+
+            size_type max_size() const { return size_type(-1) / sizeof(T); }
+#if __cplusplus >= 201103L
+            template <typename U, typename... Args>
+            void construct(U* p, Args&&... args) { new (static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+#else
+            void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) T(val); }
+#endif
+            void destroy(pointer p) { p->~T(); }
+
+            bool operator==(const pool_allocator& alloc) const { return _pool == alloc._pool; }
+            bool operator!=(const pool_allocator& alloc) const { return _pool != alloc._pool; }
+    };
+}
+
+#endif
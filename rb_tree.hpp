@@ -4,58 +4,196 @@
 #include <memory>
 #include <functional>
 #include <cstddef>
+#include <stdexcept>
+#include <pthread.h>
+#include <unistd.h>
 #include "reverse_iterator.hpp"
 #include "iterator_base.hpp"
 #include "algorithm.hpp"
 #include "pair.hpp"
+#include "type_traits.hpp"
+
+// 노드가 이 수 이상인 트리를 복사할 때는 root 근처만 직접 복제하고 그 아래 subtree들을 worker thread에서 복제한다.
+// 원소의 복사 생성자도 여러 thread에서 동시에 불리게 되므로 value_type이 is_parallel_copyable로 opt-in 했을 때만 그렇게 한다.
+// 0으로 정의하면 항상 한 thread로 복사한다. (allocator_is_thread_safe가 false인 allocator도 항상 한 thread)
+#ifndef FT_RB_TREE_PARALLEL_COPY_THRESHOLD
+# define FT_RB_TREE_PARALLEL_COPY_THRESHOLD 100000
+#endif
 
 namespace ft
 {
     enum color { black = 0, red = 1};
 
     // ============================================tree node============================================
+    // 노드는 2 byte 이상으로 정렬되므로 부모 포인터의 가장 낮은 bit는 항상 0이다.
+    // 그 bit에 색을 넣어서(_parent_color) color 멤버와 padding을 없애고, 링크를 value보다 앞에 둔다.
+    // 부모와 색은 parent()/color()와 set_parent()/set_color()로만 다룬다.
+    //
+    // FT_RB_TREE_THREADED를 정의하고 컴파일하면 노드마다 in-order 이전/다음 노드(_prev, _next)를 가지고,
+    // iterator의 ++, --가 포인터 하나를 읽는 것으로 끝난다. (노드당 포인터 2개가 늘어난다)
+    // 링크는 header(end_node)를 지나는 원형 리스트라서 header의 _next는 begin, _prev는 마지막 노드다.
+    // 정의하지 않으면 thread_* 함수들은 아무 일도 하지 않는다.
+    //
+    // FT_RB_TREE_ORDER_STATISTICS를 정의하면 노드마다 자신이 root인 subtree의 노드 수(_count)를 가지고,
+    // rb_tree/map/set에 select, rank, count_range, index, distance(O(log n))가 생긴다.
     template <typename T>
 	class rb_tree_node
 	{
         public:
             typedef T                                   data_type;
-            typedef color                               color_type;
+            typedef ft::color                           color_type;
             typedef rb_tree_node<data_type>*            node_ptr;
             typedef const rb_tree_node<data_type>*      const_node_ptr;
 
-            data_type       _value;
-            color_type      _color;
-            node_ptr        _parent;
+        private:
+            std::size_t     _parent_color;
+
+        public:
             node_ptr        _left;
             node_ptr        _right;
+#ifdef FT_RB_TREE_THREADED
+            node_ptr        _prev;
+            node_ptr        _next;
+#endif
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+            std::size_t     _count;
+#endif
+            data_type       _value;
 
-            rb_tree_node() : _value(), _color(black), _parent(), _left(), _right() {}
-            rb_tree_node(const rb_tree_node &node) : _value(node._value), _color(node._color), _parent(node._parent), _left(node._left), _right(node._right) {}
+            rb_tree_node() : _parent_color(), _left(), _right(), _value()
+            {
+#ifdef FT_RB_TREE_THREADED
+                _prev = this;
+                _next = this;
+#endif
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+                _count = 0;
+#endif
+            }
+            rb_tree_node(const rb_tree_node &node) : _parent_color(node._parent_color), _left(node._left), _right(node._right), _value(node._value)
+            {
+                this->copy_optional_fields(node);
+            }
             rb_tree_node &operator=(const rb_tree_node &node)
             {
                 if (this != &node)
                 {
-                    _value = node._value;
-                    _color = node._color;
-                    _parent = node._parent;
+                    _parent_color = node._parent_color;
                     _left = node._left;
                     _right = node._right;
+                    this->copy_optional_fields(node);
+                    _value = node._value;
                 }
                 return (*this);
             }
 
+            void copy_optional_fields(const rb_tree_node &node)
+            {
+#ifdef FT_RB_TREE_THREADED
+                _prev = node._prev;
+                _next = node._next;
+#endif
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+                _count = node._count;
+#endif
+                (void)node;
+            }
+
+            node_ptr parent() const { return reinterpret_cast<node_ptr>(_parent_color & ~static_cast<std::size_t>(red)); }
+            color_type color() const { return static_cast<color_type>(_parent_color & red); }
+
+            void set_parent(node_ptr new_parent)
+            {
+                _parent_color = reinterpret_cast<std::size_t>(new_parent) | (_parent_color & red);
+            }
+
+            void set_color(color_type new_color)
+            {
+                _parent_color = (_parent_color & ~static_cast<std::size_t>(red)) | new_color;
+            }
+
+            // 막 할당된 노드처럼 이전 값을 읽을 수 없을 때 부모, 색, 자식(과 subtree 크기)을 한 번에 초기화한다.
+            void init_links(node_ptr new_parent, color_type new_color)
+            {
+                _parent_color = reinterpret_cast<std::size_t>(new_parent) | new_color;
+                _left = NULL;
+                _right = NULL;
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+                _count = 1;
+#endif
+            }
+
             void change_color()
             {
-                _color = ((_color == red) ? black : red);
+                _parent_color ^= red;
+            }
+
+#ifdef FT_RB_TREE_THREADED
+            // in-order 리스트에서 next 바로 앞에 끼워 넣는다. (next가 header면 리스트 맨 뒤)
+            void thread_before(node_ptr next)
+            {
+                _prev = next->_prev;
+                _next = next;
+                _prev->_next = this;
+                next->_prev = this;
+            }
+
+            // in-order 리스트에서 prev 바로 뒤에 끼워 넣는다.
+            void thread_after(node_ptr prev)
+            {
+                this->thread_before(prev->_next);
+            }
+
+            void unthread()
+            {
+                _prev->_next = _next;
+                _next->_prev = _prev;
+            }
+
+            // 이 노드부터 last 바로 앞까지를 리스트에서 한 번에 뺀다.
+            void unthread_until(node_ptr last)
+            {
+                _prev->_next = last;
+                last->_prev = _prev;
+            }
+
+            // 두 리스트를 이을 때: 이 노드 바로 뒤에 next를 둔다.
+            void thread_next(node_ptr next)
+            {
+                _next = next;
+                next->_prev = this;
             }
+
+            // header 전용: first부터 last까지의 리스트를 자신에게 잇는다. 비어 있으면(first == NULL) 자기 자신을 가리킨다.
+            void thread_ends(node_ptr first, node_ptr last)
+            {
+                if (first == NULL)
+                {
+                    _next = this;
+                    _prev = this;
+                    return ;
+                }
+                _next = first;
+                first->_prev = this;
+                _prev = last;
+                last->_next = this;
+            }
+#else
+            void thread_before(node_ptr) {}
+            void thread_after(node_ptr) {}
+            void unthread() {}
+            void unthread_until(node_ptr) {}
+            void thread_next(node_ptr) {}
+            void thread_ends(node_ptr, node_ptr) {}
+#endif
     };
 
     // =========================================Utility function=========================================
     template <typename T>
     bool tree_is_left_child(typename rb_tree_node<T>::node_ptr node)
     {
-        if (node && node->_parent && node->_parent->_left)
-            return node == node->_parent->_left;
+        if (node && node->parent() && node->parent()->_left)
+            return node == node->parent()->_left;
         else
             return false;
     }
@@ -63,8 +201,8 @@ namespace ft
     template <typename T>
     bool tree_is_left_child(typename rb_tree_node<T>::const_node_ptr node)
     {
-        if (node && node->_parent && node->_parent->_left)
-            return node == node->_parent->_left;
+        if (node && node->parent() && node->parent()->_left)
+            return node == node->parent()->_left;
         else
             return false;
     }
@@ -101,6 +239,64 @@ namespace ft
         return root;
     }
 
+    // in-order 다음 노드. 마지막 노드의 다음은 end_node()다.
+    template <typename T>
+    typename rb_tree_node<T>::node_ptr tree_next(typename rb_tree_node<T>::node_ptr node)
+    {
+#ifdef FT_RB_TREE_THREADED
+        return node->_next;
+#else
+        if (node->_right != NULL)
+            return tree_min<T>(node->_right);
+        while (!tree_is_left_child<T>(node))
+            node = node->parent();
+        return node->parent();
+#endif
+    }
+
+    template <typename T>
+    typename rb_tree_node<T>::const_node_ptr tree_next(typename rb_tree_node<T>::const_node_ptr node)
+    {
+#ifdef FT_RB_TREE_THREADED
+        return node->_next;
+#else
+        if (node->_right != NULL)
+            return tree_min<T>(node->_right);
+        while (!tree_is_left_child<T>(node))
+            node = node->parent();
+        return node->parent();
+#endif
+    }
+
+    // in-order 이전 노드. end_node()의 이전은 마지막 노드다.
+    template <typename T>
+    typename rb_tree_node<T>::node_ptr tree_prev(typename rb_tree_node<T>::node_ptr node)
+    {
+#ifdef FT_RB_TREE_THREADED
+        return node->_prev;
+#else
+        if (node->_left != NULL)
+            return tree_max<T>(node->_left);
+        while (tree_is_left_child<T>(node))
+            node = node->parent();
+        return node->parent();
+#endif
+    }
+
+    template <typename T>
+    typename rb_tree_node<T>::const_node_ptr tree_prev(typename rb_tree_node<T>::const_node_ptr node)
+    {
+#ifdef FT_RB_TREE_THREADED
+        return node->_prev;
+#else
+        if (node->_left != NULL)
+            return tree_max<T>(node->_left);
+        while (tree_is_left_child<T>(node))
+            node = node->parent();
+        return node->parent();
+#endif
+    }
+
     // ============================================Iterators============================================
 
     template <typename node_ptr, typename T>
@@ -135,14 +331,7 @@ namespace ft
             pointer operator->() const { return &_node->_value; }
             rb_tree_iterator& operator++()
             {
-                if (_node->_right != NULL)
-                    _node = tree_min<value_type>(_node->_right);
-                else
-                {
-                    while (!tree_is_left_child<value_type>(_node))
-                        _node = _node->_parent;
-                    _node = _node->_parent;
-                }
+                _node = tree_next<value_type>(_node);
                 return *this;
             }
             rb_tree_iterator operator++(int)
@@ -153,14 +342,7 @@ namespace ft
             }
             rb_tree_iterator& operator--()
             {
-                if (_node->_left != NULL)
-                    _node = tree_max<value_type>(_node->_left);
-                else
-                {
-                    while (tree_is_left_child<value_type>(_node))
-                        _node = _node->_parent;
-                    _node = _node->_parent;
-                }
+                _node = tree_prev<value_type>(_node);
                 return *this;
             }
             rb_tree_iterator operator--(int)
@@ -215,14 +397,7 @@ namespace ft
             pointer operator->() const { return &_node->_value; }
             rb_tree_const_iterator& operator++()
             {
-                if (_node->_right != NULL)
-                    _node = tree_min<value_type>(_node->_right);
-                else
-				{
-                    while (!tree_is_left_child<value_type>(_node))
-                        _node = _node->_parent;
-                    _node = _node->_parent;
-				}
+                _node = tree_next<value_type>(_node);
                 return *this;
             }
             rb_tree_const_iterator operator++(int)
@@ -233,14 +408,7 @@ namespace ft
             }
             rb_tree_const_iterator& operator--()
             {
-                if (_node->_left != NULL)
-                    _node = tree_max<value_type>(_node->_left);
-                else
-                {
-                    while (tree_is_left_child<value_type>(_node))
-                        _node = _node->_parent;
-                    _node = _node->_parent;
-                }
+                _node = tree_prev<value_type>(_node);
                 return *this;
             }
             rb_tree_const_iterator operator--(int)
@@ -277,6 +445,199 @@ namespace ft
     inline bool operator!=(const rb_tree_iterator<node_ptr, T>& rhs, const rb_tree_const_iterator<const_node_ptr, T>& lhs)
     { return rhs.base() != lhs.base(); }
 
+    // ========================================Reverse Iterators========================================
+    // ft::reverse_iterator는 역참조할 때마다 _current를 복사해서 --하는데, 트리 iterator의 --는 O(log n)까지 걸린다.
+    // 트리 iterator용 reverse_iterator는 base()가 아니라 자신이 가리키는 노드(base() 바로 앞의 노드)를 _node에 들고 다녀서
+    // *, ->는 걷지 않고 ++, --는 한 칸만 걷는다. rend()는 header(end_node)를 가리키고, base()는 _node의 다음 노드다.
+    // 일반 iterator처럼 가리키는 원소를 지우면 이 iterator도 무효가 된다. (std::reverse_iterator는 base()가 남아 있으면 유효하다)
+    // 대신 base()와 가리키는 원소 사이에 원소가 들어와도 계속 같은 원소를 가리킨다.
+
+    // tree_prev와 같지만 첫 노드의 이전은 header다.
+    template <typename T>
+    typename rb_tree_node<T>::node_ptr tree_prev_or_header(typename rb_tree_node<T>::node_ptr node)
+    {
+#ifdef FT_RB_TREE_THREADED
+        return node->_prev;
+#else
+        if (node->_left != NULL)
+            return tree_max<T>(node->_left);
+        while (tree_is_left_child<T>(node))
+            node = node->parent();
+        return (node->parent() != NULL) ? node->parent() : node;
+#endif
+    }
+
+    template <typename T>
+    typename rb_tree_node<T>::const_node_ptr tree_prev_or_header(typename rb_tree_node<T>::const_node_ptr node)
+    {
+        return tree_prev_or_header<T>(const_cast<typename rb_tree_node<T>::node_ptr>(node));
+    }
+
+    // tree_next와 같지만 header의 다음은 첫 노드(비어 있으면 header)다. header만 부모가 없다.
+    template <typename T>
+    typename rb_tree_node<T>::node_ptr tree_next_or_begin(typename rb_tree_node<T>::node_ptr node)
+    {
+#ifndef FT_RB_TREE_THREADED
+        if (node->parent() == NULL)
+            return (node->_left != NULL) ? tree_min<T>(node->_left) : node;
+#endif
+        return tree_next<T>(node);
+    }
+
+    template <typename T>
+    typename rb_tree_node<T>::const_node_ptr tree_next_or_begin(typename rb_tree_node<T>::const_node_ptr node)
+    {
+        return tree_next_or_begin<T>(const_cast<typename rb_tree_node<T>::node_ptr>(node));
+    }
+
+    template <typename node_ptr, typename T>
+    class reverse_iterator<rb_tree_iterator<node_ptr, T> >
+    {
+        public:
+            typedef rb_tree_iterator<node_ptr, T>                   iterator_type;
+            typedef typename iterator_type::iterator_category       iterator_category;
+            typedef typename iterator_type::value_type              value_type;
+            typedef typename iterator_type::difference_type         difference_type;
+            typedef typename iterator_type::pointer                 pointer;
+            typedef typename iterator_type::reference               reference;
+
+        protected:
+            node_ptr            _node;
+
+        public:
+            reverse_iterator() : _node() {}
+            explicit reverse_iterator(iterator_type it) : _node(tree_prev_or_header<T>(it.base())) {}
+            template <class Iter>
+            reverse_iterator(const reverse_iterator<Iter>& rev_it) : _node(tree_prev_or_header<T>(iterator_type(rev_it.base()).base())) {}
+
+            // 트리 내부용: node를 가리키는 reverse_iterator. rbegin()은 마지막 노드, rend()는 header로 만든다.
+            static reverse_iterator from_node(node_ptr node)
+            {
+                reverse_iterator it;
+                it._node = node;
+                return it;
+            }
+
+            node_ptr node() const { return _node; }
+            iterator_type base() const { return iterator_type(tree_next_or_begin<T>(_node)); }
+
+            reference operator*() const { return _node->_value; }
+            pointer operator->() const { return &_node->_value; }
+            reverse_iterator& operator++()
+            {
+                _node = tree_prev_or_header<T>(_node);
+                return *this;
+            }
+            reverse_iterator operator++(int)
+            {
+                reverse_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            reverse_iterator& operator--()
+            {
+                _node = tree_next_or_begin<T>(_node);
+                return *this;
+            }
+            reverse_iterator operator--(int)
+            {
+                reverse_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+    };
+
+    template <typename const_node_ptr, typename T>
+    class reverse_iterator<rb_tree_const_iterator<const_node_ptr, T> >
+    {
+        public:
+            typedef rb_tree_const_iterator<const_node_ptr, T>       iterator_type;
+            typedef typename iterator_type::iterator_category       iterator_category;
+            typedef typename iterator_type::value_type              value_type;
+            typedef typename iterator_type::difference_type         difference_type;
+            typedef typename iterator_type::pointer                 pointer;
+            typedef typename iterator_type::reference               reference;
+
+        protected:
+            const_node_ptr      _node;
+
+        public:
+            reverse_iterator() : _node() {}
+            explicit reverse_iterator(iterator_type it) : _node(tree_prev_or_header<T>(it.base())) {}
+            template <class Iter>
+            reverse_iterator(const reverse_iterator<Iter>& rev_it) : _node(tree_prev_or_header<T>(iterator_type(rev_it.base()).base())) {}
+            // mutable reverse_iterator에서 바꿀 때는 노드를 그대로 받는다. (rend()에서 base()를 거치면 트리를 걷는다)
+            reverse_iterator(const reverse_iterator<rb_tree_iterator<typename rb_tree_node<T>::node_ptr, T> >& rev_it) : _node(rev_it.node()) {}
+
+            // 트리 내부용: node를 가리키는 reverse_iterator. rbegin()은 마지막 노드, rend()는 header로 만든다.
+            static reverse_iterator from_node(const_node_ptr node)
+            {
+                reverse_iterator it;
+                it._node = node;
+                return it;
+            }
+
+            const_node_ptr node() const { return _node; }
+            iterator_type base() const { return iterator_type(tree_next_or_begin<T>(_node)); }
+
+            reference operator*() const { return _node->_value; }
+            pointer operator->() const { return &_node->_value; }
+            reverse_iterator& operator++()
+            {
+                _node = tree_prev_or_header<T>(_node);
+                return *this;
+            }
+            reverse_iterator operator++(int)
+            {
+                reverse_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            reverse_iterator& operator--()
+            {
+                _node = tree_next_or_begin<T>(_node);
+                return *this;
+            }
+            reverse_iterator operator--(int)
+            {
+                reverse_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+    };
+
+    template <typename node_ptr1, typename node_ptr2, typename T>
+    inline bool operator==(const reverse_iterator<rb_tree_iterator<node_ptr1, T> >& lhs, const reverse_iterator<rb_tree_iterator<node_ptr2, T> >& rhs)
+    { return lhs.node() == rhs.node(); }
+
+    template <typename node_ptr1, typename node_ptr2, typename T>
+    inline bool operator==(const reverse_iterator<rb_tree_const_iterator<node_ptr1, T> >& lhs, const reverse_iterator<rb_tree_const_iterator<node_ptr2, T> >& rhs)
+    { return lhs.node() == rhs.node(); }
+
+    template <typename node_ptr1, typename node_ptr2, typename T>
+    inline bool operator==(const reverse_iterator<rb_tree_iterator<node_ptr1, T> >& lhs, const reverse_iterator<rb_tree_const_iterator<node_ptr2, T> >& rhs)
+    { return lhs.node() == rhs.node(); }
+
+    template <typename node_ptr1, typename node_ptr2, typename T>
+    inline bool operator==(const reverse_iterator<rb_tree_const_iterator<node_ptr1, T> >& lhs, const reverse_iterator<rb_tree_iterator<node_ptr2, T> >& rhs)
+    { return lhs.node() == rhs.node(); }
+
+    template <typename node_ptr1, typename node_ptr2, typename T>
+    inline bool operator!=(const reverse_iterator<rb_tree_iterator<node_ptr1, T> >& lhs, const reverse_iterator<rb_tree_iterator<node_ptr2, T> >& rhs)
+    { return lhs.node() != rhs.node(); }
+
+    template <typename node_ptr1, typename node_ptr2, typename T>
+    inline bool operator!=(const reverse_iterator<rb_tree_const_iterator<node_ptr1, T> >& lhs, const reverse_iterator<rb_tree_const_iterator<node_ptr2, T> >& rhs)
+    { return lhs.node() != rhs.node(); }
+
+    template <typename node_ptr1, typename node_ptr2, typename T>
+    inline bool operator!=(const reverse_iterator<rb_tree_iterator<node_ptr1, T> >& lhs, const reverse_iterator<rb_tree_const_iterator<node_ptr2, T> >& rhs)
+    { return lhs.node() != rhs.node(); }
+
+    template <typename node_ptr1, typename node_ptr2, typename T>
+    inline bool operator!=(const reverse_iterator<rb_tree_const_iterator<node_ptr1, T> >& lhs, const reverse_iterator<rb_tree_iterator<node_ptr2, T> >& rhs)
+    { return lhs.node() != rhs.node(); }
+
     // =============================================RB tree=============================================
     template <typename T, typename Compare = std::less<T>, typename Alloc = std::allocator<T> >
     class rb_tree
@@ -301,24 +662,24 @@ namespace ft
             typedef ft::reverse_iterator<const_iterator>                        const_reverse_iterator;
 
         private:
-            size_type       _size;
+            // FT_RB_TREE_ORDER_STATISTICS 없이 split/join하면 잘린 조각의 노드 수를 바로 알 수 없다. 그때는 _size_known을 false로 두고
+            // 처음 size()를 부를 때 센다. 그동안 insert/erase가 _size를 늘리고 줄여도 세면서 덮어쓰므로 상관없다.
+            mutable size_type   _size;
+            mutable bool        _size_known;
             node_type       _parent;
             node_ptr        _begin;
+            node_ptr        _last;      // 가장 큰 값을 가진 노드 (--end()), 비어있으면 end_node()
             value_compare   _compare;
             allocator_type  _value_alloc;
             node_alloc_type _node_alloc;
 
         public:
             rb_tree(const value_compare &comp, const allocator_type &alloc)
-                : _size(), _parent(), _begin(&_parent), _compare(comp), _value_alloc(alloc), _node_alloc(alloc) {}
+                : _size(), _size_known(true), _parent(), _begin(&_parent), _last(&_parent), _compare(comp), _value_alloc(alloc), _node_alloc(alloc) {}
             rb_tree(const rb_tree &obj)
-                : _size(), _parent(), _begin(&_parent), _compare(obj._compare), _value_alloc(obj._value_alloc), _node_alloc(obj._node_alloc) 
+                : _size(), _size_known(true), _parent(), _begin(&_parent), _last(&_parent), _compare(obj._compare), _value_alloc(obj._value_alloc), _node_alloc(obj._node_alloc) 
             {
-                if (obj.root() != NULL)
-                {
-                    this->root() = this->copy(obj.root());
-                    this->root()->_parent = &(this->_parent);
-                }
+                this->copy(obj);
             }
             ~rb_tree()
             {
@@ -327,7 +688,10 @@ namespace ft
                     this->destroy(this->root());
                     this->root() = NULL;
                     this->_begin = this->end_node();
+                    this->_last = this->end_node();
                 }
+                if (this->detached() != NULL)
+                    this->free_unbalanced(this->detached(), size_type(-1));
             }
             rb_tree& operator=(const rb_tree &obj)
             {
@@ -335,58 +699,142 @@ namespace ft
                 {
                     this->clear();
                     this->_compare = obj._compare;
-                    if (obj.root() != NULL)
-                    {
-                        this->root() = this->copy(obj.root());
-                        this->root()->_parent = &(this->_parent);
-                    }
+                    this->copy(obj);
+                }
+                return *this;
+            }
+#if __cplusplus >= 201103L
+            // 노드는 움직이지 않고 빈 트리와 바꾼다.
+            rb_tree(rb_tree&& obj)
+                : _size(), _size_known(true), _parent(), _begin(&_parent), _last(&_parent), _compare(obj._compare), _value_alloc(obj._value_alloc), _node_alloc(obj._node_alloc)
+            {
+                this->swap(obj);
+            }
+            rb_tree& operator=(rb_tree&& obj)
+            {
+                if (this != &obj)
+                {
+                    this->clear();
+                    this->swap(obj);
                 }
                 return *this;
             }
+#endif
 
             iterator begin() { return iterator(_begin); }
             const_iterator begin() const { return const_iterator(_begin); }
             iterator end() { return iterator(&_parent); }
             const_iterator end() const { return const_iterator(&_parent); }
-            reverse_iterator rbegin() { return reverse_iterator(end()); }
-            const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
-            reverse_iterator rend() { return reverse_iterator(begin()); }
-            const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
-
-            bool empty() const { return _size == 0; }
-            size_type size() const { return _size; }
+            reverse_iterator rbegin() { return reverse_iterator::from_node(_last); }
+            const_reverse_iterator rbegin() const { return const_reverse_iterator::from_node(_last); }
+            reverse_iterator rend() { return reverse_iterator::from_node(end_node()); }
+            const_reverse_iterator rend() const { return const_reverse_iterator::from_node(end_node()); }
+
+            bool empty() const { return (_size_known) ? _size == 0 : root() == NULL; }
+            // split/join 뒤 처음 부르면 노드를 모두 센다. (FT_RB_TREE_ORDER_STATISTICS가 아닐 때만)
+            size_type size() const
+            {
+                if (!_size_known)
+                {
+                    _size = 0;
+                    for (const_node_ptr node = _begin; node != this->end_node(); node = tree_next<value_type>(node))
+                        _size++;
+                    _size_known = true;
+                }
+                return _size;
+            }
             size_type max_size() const { return _node_alloc.max_size(); }
 
+            // 같은 값이 이미 있으면 그 노드를 돌려주고, 없으면 새 노드를 만들어 find_insert_pos가 찾은 자리에 단다.
             ft::pair<iterator, bool> insert(const value_type& val)
             {
-                iterator it = this->find(val);
-                if (it != this->end())
-                    return (ft::make_pair<iterator, bool>(it, false));
-                node_ptr new_node = this->make_node(val);
-                iterator pos;
-                this->root() = this->insert(this->root(), new_node, pos);
-                root()->_parent = &this->_parent;
-                this->insert_sort(new_node);
-                this->root()->_color = black;
-                return ft::make_pair(pos, true);
+                node_ptr parent;
+                bool is_left;
+                node_ptr same = this->find_insert_pos(val, parent, is_left);
+                if (same != NULL)
+                    return (ft::make_pair<iterator, bool>(iterator(same), false));
+                return ft::make_pair(this->insert_at(parent, is_left, this->make_node(val)), true);
+            }
+
+            // position 바로 앞 또는 바로 뒤에 val이 들어갈 자리가 있으면 root부터 내려가지 않고 그 자리에 단다.
+            // 힌트가 맞으면 비교 두 번으로 끝나고, 틀리면 insert(val)과 같다.
+            iterator insert(const_iterator position, const value_type& val)
+            {
+                node_ptr parent;
+                bool is_left;
+                node_ptr same = this->find_insert_pos(position, val, parent, is_left);
+                if (same != NULL)
+                    return iterator(same);
+                return this->insert_at(parent, is_left, this->make_node(val));
+            }
+
+#if __cplusplus >= 201103L
+            // 자리를 먼저 찾고, 새 노드가 필요할 때만 val을 옮겨서 만든다.
+            ft::pair<iterator, bool> insert(value_type&& val)
+            {
+                node_ptr parent;
+                bool is_left;
+                node_ptr same = this->find_insert_pos(val, parent, is_left);
+                if (same != NULL)
+                    return (ft::make_pair<iterator, bool>(iterator(same), false));
+                return ft::make_pair(this->insert_at(parent, is_left, this->make_node(std::move(val))), true);
+            }
+
+            iterator insert(const_iterator position, value_type&& val)
+            {
+                node_ptr parent;
+                bool is_left;
+                node_ptr same = this->find_insert_pos(position, val, parent, is_left);
+                if (same != NULL)
+                    return iterator(same);
+                return this->insert_at(parent, is_left, this->make_node(std::move(val)));
+            }
+
+            // 값을 만들어 봐야 key를 알 수 있으므로 노드를 먼저 만들고, 같은 값이 있으면 버린다.
+            template <typename... Args>
+            ft::pair<iterator, bool> emplace(Args&&... args)
+            {
+                node_ptr new_node = this->make_node(std::forward<Args>(args)...);
+                node_ptr parent;
+                bool is_left;
+                node_ptr same = this->find_insert_pos(new_node->_value, parent, is_left);
+                if (same != NULL)
+                {
+                    this->destroy_node(new_node);
+                    return (ft::make_pair<iterator, bool>(iterator(same), false));
+                }
+                return ft::make_pair(this->insert_at(parent, is_left, new_node), true);
             }
 
-            iterator insert(iterator position, const value_type& val)
+            template <typename... Args>
+            iterator emplace_hint(const_iterator position, Args&&... args)
             {
-                (void)position;
-                return (insert(val).first);
+                node_ptr new_node = this->make_node(std::forward<Args>(args)...);
+                node_ptr parent;
+                bool is_left;
+                node_ptr same = this->find_insert_pos(position, new_node->_value, parent, is_left);
+                if (same != NULL)
+                {
+                    this->destroy_node(new_node);
+                    return iterator(same);
+                }
+                return this->insert_at(parent, is_left, new_node);
             }
+#endif
 
+            // 빈 트리에 정렬된 범위가 들어오면 bulk_load로 O(n)에 만들고,
+            // 그 외에는 end() 힌트로 하나씩 넣는다 (정렬된 입력이면 원소당 비교 한 번).
             template<typename InputIterator>
             void insert(InputIterator first, InputIterator last)
             {
-                for (; first != last; first++)
-                    insert(*first);
+                this->insert_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
             }
 
             void erase(iterator position)
             {
                 node_ptr node = position.base();
+                if (node == this->_last)
+                    this->_last = (node == this->_begin) ? this->end_node() : (--iterator(node)).base();
                 if (node == this->_begin)
                 {
                     position++;
@@ -395,52 +843,308 @@ namespace ft
                 this->erase(this->root(), node);
                 if (this->root() != NULL)
                 {
-                    this->root()->_parent = this->end_node();
-                    this->root()->_color = black;
+                    this->root()->set_parent(this->end_node());
+                    this->root()->set_color(black);
                 }
+                node->unthread();
                 this->destroy_node(node);
             }
 
-            size_type erase(const value_type& val)
+            template <typename Key>
+            size_type erase(const Key& key)
             {
-                iterator iter = this->find(val);
+                iterator iter = this->find(key);
                 if (iter == this->end())
                     return 0;
                 erase(iter);
                 return 1;
             }
 
-            void erase(iterator first, iterator last)
+            // 몇 개 안 되면 하나씩 지우고, 그보다 많으면 트리를 first와 last에서 잘라(split) 가운데 subtree를 통째로 떼어 내고
+            // 양쪽을 last로 다시 잇는다(join). 재균형은 O(log n)이고, 지우는 k개는 균형을 맞추지 않고 바로 해제한다.
+            void erase(const_iterator first, const_iterator last)
+            {
+                if (first == last)
+                    return ;
+                if (first == this->begin() && last == this->end())
+                {
+                    this->clear();
+                    return ;
+                }
+                const_iterator it = first;
+                for (int i = 0; i < 16 && it != last; i++)
+                    ++it;
+                if (it == last)
+                {
+                    while (first != last)
+                        this->erase(iterator(const_cast<node_ptr>((first++).base())));
+                    return ;
+                }
+                node_ptr first_node = const_cast<node_ptr>(first.base());
+                node_ptr last_node = const_cast<node_ptr>(last.base());
+                node_ptr before = (first_node == this->_begin) ? this->end_node() : tree_prev<value_type>(first_node);
+                first_node->unthread_until(last_node);
+
+                node_ptr left;
+                node_ptr middle;
+                node_ptr right = NULL;
+                size_type left_h;
+                size_type middle_h;
+                size_type right_h = 0;
+                if (last_node != this->end_node())
+                    this->split(last_node, left, left_h, right, right_h);
+                this->split(first_node, left, left_h, middle, middle_h);
+                if (last_node != this->end_node())
+                    left = this->join(left, left_h, last_node, right, right_h, left_h);
+                this->_size -= this->free_subtree(middle) + 1;
+                this->free_node(first_node);
+
+                this->root() = left;
+                left->set_parent(this->end_node());
+                if (first_node == this->_begin)
+                    this->_begin = last_node;
+                if (last_node == this->end_node())
+                    this->_last = before;
+            }
+
+            // pred(value)가 true인 원소를 모두 지우고 지운 수를 돌려준다.
+            // in-order로 한 번 훑으면서 남길 노드는 _right로 이어 두었다가, 새로 할당하지 않고 그 노드들로 높이가 최소인 트리를 다시 세운다. O(n)
+            // pred가 던지면 나머지는 모두 남기고 트리를 세운 뒤 다시 던진다.
+            template <typename Predicate>
+            size_type erase_if(Predicate pred)
+            {
+                node_ptr keep = NULL;
+                node_ptr* keep_tail = &keep;
+                node_ptr doomed = NULL;
+                size_type kept = 0;
+                size_type erased = 0;
+                node_ptr node = this->_begin;
+                node_ptr next;
+                try
+                {
+                    for (; node != this->end_node(); node = next)
+                    {
+                        next = tree_next<value_type>(node);
+                        if (pred(node->_value))
+                        {
+                            node->_right = doomed;
+                            doomed = node;
+                            erased++;
+                        }
+                        else
+                        {
+                            *keep_tail = node;
+                            keep_tail = &node->_right;
+                            kept++;
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    for (; node != this->end_node(); node = next)
+                    {
+                        next = tree_next<value_type>(node);
+                        *keep_tail = node;
+                        keep_tail = &node->_right;
+                        kept++;
+                    }
+                    this->rebuild(keep, kept);
+                    this->free_list(doomed);
+                    throw;
+                }
+                this->rebuild(keep, kept);
+                this->free_list(doomed);
+                return erased;
+            }
+
+            // key 이상인 원소를 모두 upper로 옮긴다. upper에 있던 원소는 지워지고, 노드가 넘어가므로 upper는 이 트리의 비교 함수와 allocator를 받는다.
+            // 새로 할당하지 않고 lower_bound(key)에서 트리를 잘라 오른쪽 조각을 넘기므로 O(log n)이다.
+            // 두 조각의 크기는 FT_RB_TREE_ORDER_STATISTICS면 index로 바로 나누고, 아니면 잘린 곳이 한쪽 끝에서 가까울 때만
+            // (max_height 걸음 안) 걸어서 센다. 멀면 세지 않고 두 조각 모두 처음 size()를 부를 때 센다.
+            template <typename Key>
+            void split(const Key& key, rb_tree& upper)
+            {
+                if (&upper == this)
+                    return ;
+                upper.clear();
+                upper._compare = this->_compare;
+                upper._value_alloc = this->_value_alloc;
+                upper._node_alloc = this->_node_alloc;
+                node_ptr x = this->lower_bound(key).base();
+                if (x == this->end_node())
+                    return ;
+                if (x == this->_begin)
+                {
+                    this->swap(upper);
+                    return ;
+                }
+                size_type lower_size;
+                size_type upper_size;
+                bool sizes_known = this->count_split(x, lower_size, upper_size);
+                node_ptr before = tree_prev<value_type>(x);
+                node_ptr last = this->_last;
+
+                node_ptr l;
+                node_ptr r;
+                size_type hl;
+                size_type hr;
+                this->split(x, l, hl, r, hr);
+                r = this->join(NULL, 0, x, r, hr, hr);
+
+                this->root() = l;
+                l->set_parent(this->end_node());
+                this->_last = before;
+                this->_size = lower_size;
+                this->_size_known = sizes_known;
+                upper._size = upper_size;
+                upper._size_known = sizes_known;
+                this->_parent.thread_ends(this->_begin, before);
+
+                upper.root() = r;
+                r->set_parent(upper.end_node());
+                upper._begin = x;
+                upper._last = last;
+                upper._parent.thread_ends(x, last);
+            }
+
+            // other의 원소를 모두 이 트리로 옮기고 other를 비운다. 두 트리의 값 범위가 겹치면 std::invalid_argument를 던지고 둘 다 그대로 둔다.
+            // 한쪽이 다른 쪽보다 모두 작으면 되고 순서는 상관없다. 오른쪽 트리의 가장 작은 노드를 떼어 내 가운데 노드로 쓰고 join하므로 O(log n)
+            // 노드를 넘길 수 없는 경우(allocator가 다름, pool_allocator)는 복사해서 넣은 뒤 other를 비운다.
+            void join(rb_tree& other)
+            {
+                if (&other == this || other.root() == NULL)
+                    return ;
+                if (this->root() != NULL
+                    && !this->_compare(this->_last->_value, other._begin->_value)
+                    && !this->_compare(other._last->_value, this->_begin->_value))
+                    throw std::invalid_argument("rb_tree::join");
+                if (this->_node_alloc != other._node_alloc)
+                {
+                    this->insert(const_iterator(other._begin), const_iterator(other.end_node()));
+                    other.clear();
+                    return ;
+                }
+                if (this->root() != NULL && this->_compare(other._last->_value, this->_begin->_value))
+                    this->swap(other);
+
+                node_ptr l = this->root();
+                size_type hl = black_height(l);
+                node_ptr k = other._begin;
+                node_ptr r = other.root();
+                size_type hr;
+                node_ptr last = other._last;
+                size_type size = other._size;
+                bool size_known = other._size_known;
+                other.root() = NULL;
+                other._begin = other.end_node();
+                other._last = other.end_node();
+                other._size = 0;
+                other._size_known = true;
+                other._parent.thread_ends(NULL, NULL);
+
+                // k는 r의 가장 작은 노드라 split하면 왼쪽은 비고 오른쪽에 나머지가 남는다.
+                node_ptr empty;
+                size_type empty_h;
+                r->set_parent(this->end_node());
+                this->split(k, empty, empty_h, r, hr);
+                if (l != NULL)
+                    this->_last->thread_next(k);
+                else
+                    this->_begin = k;
+                this->root() = this->join(l, hl, k, r, hr, hl);
+                this->root()->set_parent(this->end_node());
+                this->_last = last;
+                this->_size += size;
+                this->_size_known = this->_size_known && size_known;
+                this->_parent.thread_ends(this->_begin, this->_last);
+            }
+
+            // ============================set algebra============================
+            // 이 트리를 other와의 합집합 / 교집합 / 차집합 / 대칭차로 바꾼다. 같은 값이 양쪽에 있으면 이 트리의 노드가 남는다.
+            // 크기가 비슷하면 둘을 in-order로 같이 훑어 남길 노드를 _right로 잇고 rebuild로 한 번에 세운다. O(n + m)
+            // 한쪽(m개)이 훨씬 작으면(prefer_search) 작은 쪽 원소마다 큰 쪽에서 찾는다. O(m log n)
+            //   큰 쪽에 넣거나 지울 때: 원소마다 root부터 insert / lower_bound + erase (std::set에 loop로 넣는 것과 같다)
+            //   작은 쪽(이 트리)을 걸러 낼 때: 앞의 답부터 이어서 찾고(lower_bound_from), 아주 치우치면 root부터 찾는다.
+
+            void merge_union(const rb_tree& other)
+            {
+                if (&other == this || other.root() == NULL)
+                    return ;
+                if (!prefer_search(other.size(), this->size()))
+                {
+                    this->merge_linear(other, true, true, true);
+                    return ;
+                }
+                for (const_node_ptr theirs = other._begin; theirs != other.end_node(); theirs = tree_next<value_type>(theirs))
+                    this->insert(theirs->_value);
+            }
+
+            void merge_intersection(const rb_tree& other)
+            {
+                if (&other == this)
+                    return ;
+                if (prefer_search(this->size(), other.size()))
+                    this->filter_by(other, true);
+                else
+                    this->merge_linear(other, false, true, false);
+            }
+
+            void merge_difference(const rb_tree& other)
+            {
+                if (&other == this)
+                {
+                    this->clear();
+                    return ;
+                }
+                if (prefer_search(other.size(), this->size()))
+                    this->erase_found(other, false);
+                else if (prefer_search(this->size(), other.size()))
+                    this->filter_by(other, false);
+                else
+                    this->merge_linear(other, true, false, false);
+            }
+
+            void merge_symmetric_difference(const rb_tree& other)
             {
-                while (first != last)
-                    erase(first++);
+                if (&other == this)
+                {
+                    this->clear();
+                    return ;
+                }
+                if (prefer_search(other.size(), this->size()))
+                    this->erase_found(other, true);
+                else
+                    this->merge_linear(other, true, false, true);
             }
 
             void swap(rb_tree& t)
             {
                 ft::swap(this->_begin, t._begin);
+                ft::swap(this->_last, t._last);
                 ft::swap(this->_parent._left, t._parent._left);
                 ft::swap(this->_size, t._size);
-                if (this->_size != 0 && t._size != 0)
-                	ft::swap(this->root()->_parent, t.root()->_parent);
-                else if (this->_size != 0)
-                	this->root()->_parent = this->end_node();
-                else if (t._size != 0)
-                	t.root()->_parent = t.end_node();
+                ft::swap(this->_size_known, t._size_known);
+                this->reset_end_links();
+                t.reset_end_links();
                 ft::swap(this->_compare, t._compare);
+                // 노드는 자신을 할당한 allocator로 돌려줘야 하므로 allocator도 같이 바꾼다. (pool_allocator)
+                ft::swap(this->_value_alloc, t._value_alloc);
+                ft::swap(this->_node_alloc, t._node_alloc);
             }
 
-            size_type count(const value_type& val) const { return find(val) != this->end(); }
+            template <typename Key>
+            size_type count(const Key& key) const { return find(key) != this->end(); }
 
-            iterator find(const value_type& val)
+            template <typename Key>
+            iterator find(const Key& key)
             {
                 node_ptr node = this->root();
 
                 while(node != NULL)
                 {
-                    if (this->_compare(node->_value, val))
+                    if (this->_compare(node->_value, key))
                         node = node->_right;
-                    else if (this->_compare(val, node->_value))
+                    else if (this->_compare(key, node->_value))
                         node = node->_left;
                     else
                         return iterator(node);
@@ -448,15 +1152,16 @@ namespace ft
                 return this->end();
             }
 
-            const_iterator find(const value_type& val) const
+            template <typename Key>
+            const_iterator find(const Key& key) const
             {
                 const_node_ptr node = this->root();
                 
                 while (node != NULL)
                 {
-                    if (this->_compare(node->_value, val))
+                    if (this->_compare(node->_value, key))
                         node = node->_right;
-                    else if (this->_compare(val, node->_value))
+                    else if (this->_compare(key, node->_value))
                         node = node->_left;
                     else
                         return const_iterator(node);
@@ -471,18 +1176,45 @@ namespace ft
                     this->destroy(this->root());
                     this->root() = NULL;
                     this->_begin = this->end_node();
+                    this->_last = this->end_node();
+                    this->_parent.thread_ends(NULL, NULL);
                 }
+                this->_size = 0;
+                this->_size_known = true;
             }
 
-            iterator lower_bound(const value_type& val)
+            // 처음 부를 때 모든 노드를 떼어 내서(detached()) 트리는 바로 비고, 그 뒤로 계속 쓸 수 있다.
+            // 떼어 낸 노드는 균형을 맞추지 않고 한 단계씩 푼다. 한 단계는 노드 하나를 해제하거나 오른쪽으로 한 번 회전하는 것이고,
+            // 부를 때마다 최대 budget 단계를 한다. (노드 n개면 모두 합쳐 2n 단계 이하)
+            // 더 해제할 것이 없으면 true
+            bool clear_some(size_type budget)
             {
-                node_ptr node = this->root();
+                if (this->detached() == NULL)
+                {
+                    if (this->root() == NULL)
+                        return true;
+                    this->detached() = this->root();
+                    this->root() = NULL;
+                    this->_size = 0;
+                    this->_size_known = true;
+                    this->_begin = this->end_node();
+                    this->_last = this->end_node();
+                    this->_parent.thread_ends(NULL, NULL);
+                }
+                this->detached() = this->free_unbalanced(this->detached(), budget);
+                return this->detached() == NULL && this->root() == NULL;
+            }
+
+            template <typename Key>
+            iterator lower_bound(const Key& key)
+            {
+                node_ptr node = this->root();
                 node_ptr pos = this->end_node();
 
                 while (node != NULL)
                 {
-                    // node->_value <= val : ture
-                    if (!this->_compare(node->_value, val))
+                    // node->_value <= key : ture
+                    if (!this->_compare(node->_value, key))
                     {
                         pos = node;
                         node = node->_left;
@@ -493,14 +1225,15 @@ namespace ft
                 return iterator(pos);
             }
 
-            const_iterator lower_bound(const value_type& val) const
+            template <typename Key>
+            const_iterator lower_bound(const Key& key) const
             {
                 const_node_ptr node = this->root();
                 const_node_ptr pos = this->end_node();
 
                 while (node != NULL)
                 {
-                    if (!this->_compare(node->_value, val))
+                    if (!this->_compare(node->_value, key))
                     {
                         pos = node;
                         node = node->_left;
@@ -511,15 +1244,16 @@ namespace ft
                 return const_iterator(pos);
             }
 
-            iterator upper_bound(const value_type& val)
+            template <typename Key>
+            iterator upper_bound(const Key& key)
             {
                 node_ptr node = this->root();
                 node_ptr pos = this->end_node();
 
                 while (node != NULL)
                 {
-                    // val < node->_value : true
-                    if (this->_compare(val, node->_value))
+                    // key < node->_value : true
+                    if (this->_compare(key, node->_value))
                     {
                         pos = node;
                         node = node->_left;
@@ -530,14 +1264,15 @@ namespace ft
                 return iterator(pos);
             }
 
-            const_iterator upper_bound(const value_type& val) const
+            template <typename Key>
+            const_iterator upper_bound(const Key& key) const
             {
                 const_node_ptr node = this->root();
                 const_node_ptr pos = this->end_node();
 
                 while (node != NULL)
                 {
-                    if (this->_compare(val, node->_value))
+                    if (this->_compare(key, node->_value))
                     {
                         pos = node;
                         node = node->_left;
@@ -548,78 +1283,1015 @@ namespace ft
                 return const_iterator(pos);
             }
 
-            ft::pair<iterator,iterator> equal_range( const value_type& val )
+            template <typename Key>
+            ft::pair<iterator,iterator> equal_range(const Key& key)
             {
-                return ft::make_pair(this->lower_bound(val), this->upper_bound(val));
+                return ft::make_pair(this->lower_bound(key), this->upper_bound(key));
             }
-            ft::pair<const_iterator,const_iterator> equal_range( const value_type& val ) const
+            template <typename Key>
+            ft::pair<const_iterator,const_iterator> equal_range(const Key& key) const
             {
-                return ft::make_pair(this->lower_bound(val), this->upper_bound(val));
+                return ft::make_pair(this->lower_bound(key), this->upper_bound(key));
+            }
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+            // ======================================Order statistics======================================
+            // k번째(0부터)로 작은 값. k >= size()면 end()
+            iterator select(size_type k)
+            {
+                node_ptr node = this->root();
+
+                while (node != NULL)
+                {
+                    size_type left_size = subtree_size(node->_left);
+                    if (k < left_size)
+                        node = node->_left;
+                    else if (k == left_size)
+                        return iterator(node);
+                    else
+                    {
+                        k -= left_size + 1;
+                        node = node->_right;
+                    }
+                }
+                return this->end();
+            }
+
+            const_iterator select(size_type k) const
+            {
+                return const_iterator(const_cast<rb_tree*>(this)->select(k).base());
+            }
+
+            // key보다 작은 값의 개수 (= lower_bound(key)의 index)
+            template <typename Key>
+            size_type rank(const Key& key) const
+            {
+                const_node_ptr node = this->root();
+                size_type count = 0;
+
+                while (node != NULL)
+                {
+                    if (this->_compare(node->_value, key))
+                    {
+                        count += subtree_size(node->_left) + 1;
+                        node = node->_right;
+                    }
+                    else
+                        node = node->_left;
+                }
+                return count;
+            }
+
+            // [lo, hi) 범위에 있는 값의 개수
+            template <typename Key>
+            size_type count_range(const Key& lo, const Key& hi) const
+            {
+                size_type lo_rank = this->rank(lo);
+                size_type hi_rank = this->rank(hi);
+                return (hi_rank > lo_rank) ? hi_rank - lo_rank : 0;
+            }
+
+            // position 앞에 있는 값의 개수. end()면 size()
+            size_type index(const_iterator position) const
+            {
+                const_node_ptr node = position.base();
+
+                if (node == this->end_node())
+                    return this->_size;
+                size_type count = subtree_size(node->_left);
+                while (node->parent() != this->end_node())
+                {
+                    if (!tree_is_left_child<value_type>(node))
+                        count += subtree_size(node->parent()->_left) + 1;
+                    node = node->parent();
+                }
+                return count;
             }
+
+            difference_type distance(const_iterator first, const_iterator last) const
+            {
+                return static_cast<difference_type>(this->index(last)) - static_cast<difference_type>(this->index(first));
+            }
+#endif
+
             value_compare value_comp() const { return this->_compare; }
             allocator_type get_allocator() const { return this->_value_alloc; }
     
         private:
             node_ptr& root() { return this->_parent._left; }
             const_node_ptr& root() const { return const_cast<const_node_ptr&>(this->_parent._left); }
+            // clear_some이 떼어 낸 노드들. header의 _right는 트리에서 쓰지 않으므로 그 자리에 둔다. (swap해도 따라가지 않는다)
+            node_ptr& detached() { return this->_parent._right; }
             node_ptr end_node() { return &(this->_parent);}
             const_node_ptr end_node() const { return const_cast<const_node_ptr>(&(this->_parent)); }
 
-            node_ptr insert(node_ptr node, node_ptr new_node, iterator& pos)
+            // 다른 트리와 root를 주고받은 뒤 root의 부모와 빈 트리의 _begin/_last가 자기 end_node()를 가리키게 한다.
+            void reset_end_links()
             {
-                if (node == NULL)
+                if (this->root() != NULL)
                 {
-                    pos = new_node;
-                    return new_node;
+                    this->root()->set_parent(this->end_node());
+                    this->_parent.thread_ends(this->_begin, this->_last);
                 }
-                if (this->_compare(new_node->_value, node->_value))
+                else
                 {
-                    node->_left = this->insert(node->_left, new_node, pos);
-                    node->_left->_parent = node;
+                    this->_begin = this->end_node();
+                    this->_last = this->end_node();
+                    this->_parent.thread_ends(NULL, NULL);
                 }
-                else if (this->_compare(node->_value, new_node->_value))
+            }
+
+            template<typename InputIterator>
+            void insert_range(InputIterator first, InputIterator last, ft::input_iterator_tag)
+            {
+                for (; first != last; first++)
+                    this->insert(this->end(), *first);
+            }
+
+            // forward iterator는 두 번 읽을 수 있으므로 먼저 정렬 여부를 확인해 본다.
+            template<typename ForwardIterator>
+            void insert_range(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+            {
+                size_type n = 0;
+                if (this->empty() && this->count_sorted(first, last, n))
+                    this->bulk_load(first, n);
+                else
+                    this->insert_range(first, last, ft::input_iterator_tag());
+            }
+
+            // [first, last)가 오름차순(같은 값은 연속으로만)이면 true와 함께 서로 다른 값의 개수를 n에 담는다.
+            // 정렬이 깨진 곳을 만나면 바로 false를 돌려준다.
+            template<typename ForwardIterator>
+            bool count_sorted(ForwardIterator first, ForwardIterator last, size_type& n) const
+            {
+                n = 0;
+                if (first == last)
+                    return true;
+                ForwardIterator prev = first;
+                n = 1;
+                for (++first; first != last; ++first, ++prev)
                 {
-                    node->_right = this->insert(node->_right, new_node, pos);
-                    node->_right->_parent = node;
+                    if (this->_compare(*prev, *first))
+                        n++;
+                    else if (this->_compare(*first, *prev))
+                        return false;
                 }
-                else
-                    pos = node;
+                return true;
+            }
+
+            // 정렬된 범위의 서로 다른 값 n개로 높이가 최소인 트리를 한 번에 세운다.
+            // 마지막 level을 제외한 모든 level이 꽉 차므로, 마지막 level만 red로 칠하면
+            // 모든 경로의 black 수가 같아진다.
+            template<typename ForwardIterator>
+            void bulk_load(ForwardIterator first, size_type n)
+            {
+                size_type height = 0;
+                for (size_type m = n; m > 0; m >>= 1)
+                    height++;
+                if (n == 0)
+                    return ;
+                try
+                {
+                    this->root() = this->build_subtree(first, n, 1, (height > 1) ? height : 0);
+                }
+                catch (...)
+                {
+                    this->_last = this->end_node();
+                    this->_parent.thread_ends(NULL, NULL);
+                    throw;
+                }
+                this->root()->set_parent(this->end_node());
+                this->_begin = tree_min<value_type>(this->root());
+            }
+
+            // 범위에서 다음 n개의 값을 in-order로 꺼내 subtree를 만들고 root를 돌려준다.
+            // 만드는 동안 _last는 직전에 만든 노드라서, 연속으로 나오는 같은 값은 insert처럼 처음 것만 남긴다.
+            template<typename ForwardIterator>
+            node_ptr build_subtree(ForwardIterator& first, size_type n, size_type depth, size_type red_depth)
+            {
+                if (n == 0)
+                    return NULL;
+                size_type left_size = (n - 1) / 2;
+                node_ptr left = this->build_subtree(first, left_size, depth + 1, red_depth);
+                node_ptr node;
+                try
+                {
+                    if (this->_last != this->end_node())
+                    {
+                        while (!this->_compare(this->_last->_value, *first))
+                            ++first;
+                    }
+                    node = this->make_node(*first);
+                    ++first;
+                }
+                catch (...)
+                {
+                    this->destroy(left);
+                    throw;
+                }
+                this->_last = node;
+                node->thread_before(this->end_node());
+                node->_left = left;
+                if (left != NULL)
+                    left->set_parent(node);
+                node->set_color((depth == red_depth) ? red : black);
+                try
+                {
+                    node->_right = this->build_subtree(first, n - 1 - left_size, depth + 1, red_depth);
+                }
+                catch (...)
+                {
+                    this->destroy(node);
+                    throw;
+                }
+                if (node->_right != NULL)
+                    node->_right->set_parent(node);
+                this->update_count(node);
                 return node;
             }
 
+            // root에서 한 번만 내려가면서 새 노드가 붙을 자리(parent와 왼쪽/오른쪽)를 찾는다.
+            // 같은 값이 이미 있으면 그 자리에서 바로 멈추고 그 노드를 돌려준다. 없으면 NULL
+            node_ptr find_insert_pos(const value_type& val, node_ptr& parent, bool& is_left)
+            {
+                node_ptr node = this->root();
+                parent = this->end_node();
+                is_left = true;
+
+                while (node != NULL)
+                {
+                    parent = node;
+                    if (this->_compare(val, node->_value))
+                    {
+                        is_left = true;
+                        node = node->_left;
+                    }
+                    else if (this->_compare(node->_value, val))
+                    {
+                        is_left = false;
+                        node = node->_right;
+                    }
+                    else
+                        return node;
+                }
+                return NULL;
+            }
+
+            // position 근처에서 자리를 찾는다. 힌트가 틀리면 root부터 내려간다.
+            node_ptr find_insert_pos(const_iterator position, const value_type& val, node_ptr& parent, bool& is_left)
+            {
+                node_ptr pos = const_cast<node_ptr>(position.base());
+
+                if (pos == this->end_node())
+                {
+                    // emplace_hint는 노드를 먼저 만들어서 _size가 이미 늘어 있으므로 empty() 대신 _last로 본다.
+                    if (this->_last != this->end_node() && this->_compare(this->_last->_value, val))
+                        return this->insert_pos(this->_last, false, parent, is_left);
+                }
+                else if (this->_compare(val, pos->_value))
+                {
+                    if (pos == this->_begin)
+                        return this->insert_pos(pos, true, parent, is_left);
+                    node_ptr prev = (--iterator(pos)).base();
+                    if (this->_compare(prev->_value, val))
+                    {
+                        // prev의 오른쪽 subtree가 있다면 pos는 그 subtree의 최솟값이라 왼쪽 자식이 없다.
+                        if (prev->_right == NULL)
+                            return this->insert_pos(prev, false, parent, is_left);
+                        return this->insert_pos(pos, true, parent, is_left);
+                    }
+                }
+                else if (this->_compare(pos->_value, val))
+                {
+                    if (pos == this->_last)
+                        return this->insert_pos(pos, false, parent, is_left);
+                    node_ptr next = (++iterator(pos)).base();
+                    if (this->_compare(val, next->_value))
+                    {
+                        if (pos->_right == NULL)
+                            return this->insert_pos(pos, false, parent, is_left);
+                        return this->insert_pos(next, true, parent, is_left);
+                    }
+                }
+                else
+                    return pos;
+                return this->find_insert_pos(val, parent, is_left);
+            }
+
+            static node_ptr insert_pos(node_ptr at, bool left, node_ptr& parent, bool& is_left)
+            {
+                parent = at;
+                is_left = left;
+                return NULL;
+            }
+
+            // parent의 비어있는 왼쪽(is_left) 또는 오른쪽 자리에 새 노드(new_node)를 달고 균형을 맞춘다.
+            // 빈 트리라면 parent는 end_node()이고 새 노드는 root가 된다.
+            iterator insert_at(node_ptr parent, bool is_left, node_ptr new_node)
+            {
+                new_node->set_parent(parent);
+                if (is_left)
+                {
+                    new_node->thread_before(parent);
+                    parent->_left = new_node;
+                    if (parent == this->_begin)
+                        this->_begin = new_node;
+                    if (parent == this->end_node())
+                        this->_last = new_node;
+                }
+                else
+                {
+                    new_node->thread_after(parent);
+                    parent->_right = new_node;
+                    if (parent == this->_last)
+                        this->_last = new_node;
+                }
+                this->add_count_upward(parent, 1);
+                this->insert_sort(new_node);
+                this->root()->set_color(black);
+                return iterator(new_node);
+            }
+
+#if __cplusplus >= 201103L
+            template <typename... Args>
+            node_ptr make_node(Args&&... args)
+            {
+                node_ptr new_node = _node_alloc.allocate(1);
+                try
+                {
+                    _value_alloc.construct(&new_node->_value, std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    _node_alloc.deallocate(new_node, 1);
+                    throw;
+                }
+                new_node->init_links(NULL, red);
+                ++_size;
+                return new_node;
+            }
+#else
             node_ptr make_node(const value_type& val)
             {
                 node_ptr new_node = _node_alloc.allocate(1);
-                _value_alloc.construct(&new_node->_value, val);
-                new_node->_color = red;
-                new_node->_parent = NULL;
-                new_node->_left = NULL;
-                new_node->_right = NULL;
-                if (this->empty() || this->_compare(val, this->_begin->_value))
-                    this->_begin = new_node;
+                try
+                {
+                    _value_alloc.construct(&new_node->_value, val);
+                }
+                catch (...)
+                {
+                    _node_alloc.deallocate(new_node, 1);
+                    throw;
+                }
+                new_node->init_links(NULL, red);
                 ++_size;
                 return new_node;
             }
+#endif
 
-            node_ptr copy(const_node_ptr node)
+            // 빈 트리에서 불려야 한다. obj의 모양과 색(과 subtree 크기)을 그대로 복제하므로 비교도 재균형도 하지 않고,
+            // _begin, _last, _size는 끝에서 한 번만 정한다.
+            void copy(const rb_tree& obj)
             {
-                if (node == NULL)
-                    return NULL;
-                node_ptr new_node = make_node(node->_value);
-                new_node->_left = this->copy(node->_left);
-                if (new_node->_left != NULL)
-                    new_node->_left->_parent = new_node;
-                new_node->_right = this->copy(node->_right);
-                if (new_node->_right != NULL)
-                    new_node->_right->_parent = new_node;
-                return new_node;
+                if (obj.root() == NULL)
+                    return ;
+                try
+                {
+                    if (obj.size() >= FT_RB_TREE_PARALLEL_COPY_THRESHOLD && FT_RB_TREE_PARALLEL_COPY_THRESHOLD > 0
+                        && ft::allocator_is_thread_safe<allocator_type>::value
+                        && ft::is_parallel_copyable<value_type>::value)
+                        this->clone_parallel(obj.root());
+                    else
+                        this->root() = this->clone_subtree(obj.root(), this->end_node());
+                }
+                catch (...)
+                {
+                    this->free_subtree(this->root());
+                    this->root() = NULL;
+                    throw;
+                }
+                this->_begin = tree_min<value_type>(this->root());
+                this->_last = tree_max<value_type>(this->root());
+                this->_size = obj._size;
+                this->_size_known = true;
+                this->link_threads();
+            }
+
+            // src와 같은 값, 같은 색의 노드를 만든다. 자식은 아직 없다.
+            node_ptr clone_node(const_node_ptr src, node_ptr parent)
+            {
+                node_ptr node = this->_node_alloc.allocate(1);
+                try
+                {
+                    this->_value_alloc.construct(&node->_value, src->_value);
+                }
+                catch (...)
+                {
+                    this->_node_alloc.deallocate(node, 1);
+                    throw;
+                }
+                node->init_links(parent, src->color());
+                this->copy_count(node, src);
+                return node;
+            }
+
+            // src가 root인 subtree를 복제해서 새 root를 돌려준다. std::map처럼 오른쪽 subtree는 재귀로, 왼쪽 줄기는 loop로 내려간다.
+            // 부모 포인터로 되돌아 올라가며 복제하면 한참 전에 만든 노드와 원본을 다시 읽느라 cache miss가 나서 std보다 느렸다.
+            // 재귀 깊이는 트리 높이를 넘지 않는다. 실패하면 만든 노드를 모두 해제하고 다시 던진다.
+            // _size는 건드리지 않으므로 worker thread에서 불러도 된다.
+            node_ptr clone_subtree(const_node_ptr src, node_ptr parent)
+            {
+                node_ptr top = this->clone_node(src, parent);
+                try
+                {
+                    if (src->_right != NULL)
+                        top->_right = this->clone_subtree(src->_right, top);
+                    parent = top;
+                    src = src->_left;
+                    while (src != NULL)
+                    {
+                        node_ptr node = this->clone_node(src, parent);
+                        parent->_left = node;
+                        if (src->_right != NULL)
+                            node->_right = this->clone_subtree(src->_right, node);
+                        parent = node;
+                        src = src->_left;
+                    }
+                }
+                catch (...)
+                {
+                    this->free_subtree(top);
+                    throw;
+                }
+                return top;
+            }
+
+            // worker thread 하나가 맡는 subtree. 결과는 *slot(부모의 _left 또는 _right)에 바로 쓴다.
+            struct clone_job
+            {
+                rb_tree*        tree;
+                const_node_ptr  src;
+                node_ptr        parent;
+                node_ptr*       slot;
+            };
+
+            static void* clone_worker(void* arg)
+            {
+                clone_job* job = static_cast<clone_job*>(arg);
+                try
+                {
+                    *job->slot = job->tree->clone_subtree(job->src, job->parent);
+                }
+                catch (...)
+                {
+                    // 예외는 thread를 넘어가지 못하므로 비워 두고, join한 뒤 원래 thread에서 다시 복제한다.
+                    *job->slot = NULL;
+                }
+                return NULL;
+            }
+
+            // root에서 depth level까지의 노드는 직접 복제하고, 그 아래 subtree들은 job으로 남긴다.
+            void clone_top(const_node_ptr src, node_ptr parent, node_ptr* slot, size_type depth, clone_job* jobs, size_type& n_jobs)
+            {
+                node_ptr node = this->clone_node(src, parent);
+                *slot = node;
+                const_node_ptr children[2] = { src->_left, src->_right };
+                node_ptr* slots[2] = { &node->_left, &node->_right };
+                for (int i = 0; i < 2; i++)
+                {
+                    if (children[i] == NULL)
+                        continue ;
+                    if (depth == 0)
+                    {
+                        clone_job job = { this, children[i], node, slots[i] };
+                        jobs[n_jobs++] = job;
+                    }
+                    else
+                        this->clone_top(children[i], node, slots[i], depth - 1, jobs, n_jobs);
+                }
+            }
+
+            // CPU 수만큼(최대 8개) subtree를 나눠 worker thread에서 복제한다. 첫 job은 이 thread가 맡는다.
+            // thread를 만들지 못했거나 worker가 실패한 subtree는 이 thread에서 다시 복제하므로 예외도 여기서 나온다.
+            void clone_parallel(const_node_ptr src)
+            {
+                long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+                size_type depth = 0;
+                while (depth < 3 && (1L << (depth + 1)) <= cpus)
+                    depth++;
+                if (depth == 0)
+                {
+                    this->root() = this->clone_subtree(src, this->end_node());
+                    return ;
+                }
+                clone_job jobs[1 << 3];
+                pthread_t threads[1 << 3];
+                bool started[1 << 3];
+                size_type n_jobs = 0;
+                this->clone_top(src, this->end_node(), &this->root(), depth - 1, jobs, n_jobs);
+                for (size_type i = 1; i < n_jobs; i++)
+                    started[i] = (pthread_create(&threads[i], NULL, &rb_tree::clone_worker, &jobs[i]) == 0);
+                if (n_jobs > 0)
+                    clone_worker(&jobs[0]);
+                for (size_type i = 1; i < n_jobs; i++)
+                {
+                    if (started[i])
+                        pthread_join(threads[i], NULL);
+                }
+                for (size_type i = 0; i < n_jobs; i++)
+                {
+                    if (*jobs[i].slot == NULL)
+                        *jobs[i].slot = this->clone_subtree(jobs[i].src, jobs[i].parent);
+                }
+            }
+
+            // FT_RB_TREE_THREADED일 때 복제가 끝난 트리의 노드들을 in-order로 thread 리스트에 잇는다.
+            // 복제 중에는 노드가 in-order로 만들어지지 않으므로 끝나고 한 번에 한다.
+            void link_threads()
+            {
+#ifdef FT_RB_TREE_THREADED
+                node_ptr node = tree_min<value_type>(this->root());
+                while (node != this->end_node())
+                {
+                    node->thread_before(this->end_node());
+                    if (node->_right != NULL)
+                        node = tree_min<value_type>(node->_right);
+                    else
+                    {
+                        while (!tree_is_left_child<value_type>(node))
+                            node = node->parent();
+                        node = node->parent();
+                    }
+                }
+#endif
             }
 
             void destroy_node(node_ptr node)
+            {
+                this->free_node(node);
+                this->_size--;
+            }
+
+            // _size를 바꾸지 않고 노드를 해제한다. (아직 _size에 들어가지 않은 복제 중인 노드)
+            void free_node(node_ptr node)
             {
                 this->_value_alloc.destroy(&node->_value);
                 this->_node_alloc.deallocate(node, 1);
-                this->_size--;
+            }
+
+            // split이 x 앞에서 자를 때 앞 조각(lower)과 x부터의 뒤 조각(upper)의 노드 수. 둘 다 알면 true
+            // subtree 크기가 있으면 index로 O(log n)이다. 없으면 x에서 앞뒤로 한 칸씩 번갈아 걸어 먼저 끝에 닿은 쪽을 세고
+            // 나머지는 _size에서 뺀다. max_height 걸음 안에 끝에 닿지 않으면 세지 않는다. (O(log n)을 넘지 않도록)
+            bool count_split(node_ptr x, size_type& lower, size_type& upper) const
+            {
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+                lower = this->index(const_iterator(x));
+                upper = this->_size - lower;
+                return true;
+#else
+                const_node_ptr forward = x;
+                const_node_ptr backward = x;
+                lower = 0;
+                upper = 0;
+                for (size_type steps = 0; steps < max_height; steps++)
+                {
+                    if (backward == this->_begin)
+                    {
+                        lower = steps;
+                        upper = this->_size - steps;
+                        return this->_size_known;
+                    }
+                    if (forward == this->end_node())
+                    {
+                        upper = steps;
+                        lower = this->_size - steps;
+                        return this->_size_known;
+                    }
+                    backward = tree_prev<value_type>(backward);
+                    forward = tree_next<value_type>(forward);
+                }
+                return false;
+#endif
+            }
+
+            // 해제한 노드 수를 돌려준다.
+            size_type free_subtree(node_ptr node)
+            {
+                if (node == NULL)
+                    return 0;
+                size_type n = free_subtree(node->_left) + free_subtree(node->_right);
+                free_node(node);
+                return n + 1;
+            }
+
+            // 부모 링크와 색을 보지 않고 node가 root인 subtree를 최대 budget 단계 해제하고, 남은 subtree의 root를 돌려준다.
+            // 왼쪽 자식이 있으면 오른쪽으로 회전해서 올리고, 없으면 node를 해제하고 오른쪽 자식으로 간다.
+            // 재귀도 추가 메모리도 없다. 회전할 때마다 오른쪽 끝 줄기에 노드가 하나씩 늘어나므로 회전은 모두 n번 이하다.
+            node_ptr free_unbalanced(node_ptr node, size_type budget)
+            {
+                for (; budget > 0 && node != NULL; budget--)
+                {
+                    node_ptr left = node->_left;
+                    if (left != NULL)
+                    {
+                        node->_left = left->_right;
+                        left->_right = node;
+                        node = left;
+                    }
+                    else
+                    {
+                        node_ptr next = node->_right;
+                        this->free_node(node);
+                        node = next;
+                    }
+                }
+                return node;
+            }
+
+            // _right로 이어진 노드들을 해제한다.
+            void free_list(node_ptr list)
+            {
+                while (list != NULL)
+                {
+                    node_ptr next = list->_right;
+                    this->free_node(list);
+                    list = next;
+                }
+            }
+
+            // ============================split / join============================
+            // 독립된 트리(root의 부모가 end_node()인 트리 조각)를 나누고 잇는 함수들. 트리 조각은 root가 black이고
+            // black height(root에서 NULL까지 지나는 black 노드 수, root 포함)를 같이 들고 다닌다.
+            // join은 end_node()의 _left를 임시 root 자리로 쓰므로, 부른 쪽에서 마지막에 root()를 다시 정해야 한다.
+
+            // 높이가 2 * log2(n + 1)을 넘지 않으므로 size_type의 bit 수의 두 배면 충분하다.
+            static const size_type max_height = 2 * sizeof(size_type) * 8;
+
+            static size_type black_height(const_node_ptr node)
+            {
+                size_type h = 0;
+                for (; node != NULL; node = node->_left)
+                    h += (node->color() == black);
+                return h;
+            }
+
+            // subtree를 독립된 트리로 쓸 수 있게 root를 black으로 칠한다. (red였으면 black height가 하나 는다)
+            static void make_root_black(node_ptr root, size_type& h)
+            {
+                if (root != NULL && root->color() == red)
+                {
+                    root->set_color(black);
+                    h++;
+                }
+            }
+
+            // l의 모든 노드 < k < r의 모든 노드일 때 셋을 하나의 red-black tree로 이어 root를 돌려준다.
+            // 높이가 높은 쪽의 가장자리를 따라 black height가 같은 곳까지 내려가 k를 red로 달고 insert_sort로 고치므로 O(|hl - hr| + 1)
+            // 결과의 black height는 h에 담긴다.
+            node_ptr join(node_ptr l, size_type hl, node_ptr k, node_ptr r, size_type hr, size_type& h)
+            {
+                node_ptr header = this->end_node();
+                node_ptr parent = header;
+                bool is_left = true;
+                if (hl >= hr)
+                {
+                    header->_left = l;
+                    if (l != NULL)
+                        l->set_parent(header);
+                    node_ptr spine = l;
+                    for (size_type spine_h = hl; spine_h > hr; spine_h--)
+                    {
+                        parent = spine;
+                        is_left = false;
+                        spine = spine->_right;
+                        if (spine != NULL && spine->color() == red)
+                        {
+                            parent = spine;
+                            spine = spine->_right;
+                        }
+                    }
+                    k->_left = spine;
+                    k->_right = r;
+                }
+                else
+                {
+                    header->_left = r;
+                    r->set_parent(header);
+                    node_ptr spine = r;
+                    for (size_type spine_h = hr; spine_h > hl; spine_h--)
+                    {
+                        parent = spine;
+                        is_left = true;
+                        spine = spine->_left;
+                        if (spine != NULL && spine->color() == red)
+                        {
+                            parent = spine;
+                            spine = spine->_left;
+                        }
+                    }
+                    k->_left = l;
+                    k->_right = spine;
+                }
+                if (is_left)
+                    parent->_left = k;
+                else
+                    parent->_right = k;
+                k->set_parent(parent);
+                k->set_color(red);
+                if (k->_left != NULL)
+                    k->_left->set_parent(k);
+                if (k->_right != NULL)
+                    k->_right->set_parent(k);
+                this->update_count(k);
+                this->add_count_upward(parent, 1 + subtree_size((hl >= hr) ? r : l));
+                this->insert_sort(k);
+
+                node_ptr root = header->_left;
+                h = (hl >= hr) ? hl : hr;
+                make_root_black(root, h);
+                return root;
+            }
+
+            // x가 속한 트리 조각을 x보다 앞의 노드들(l)과 뒤의 노드들(r)로 나눈다. x는 어느 쪽에도 들어가지 않는다.
+            // x에서 root까지 올라가며 지나는 노드와 그 반대쪽 subtree를 join으로 l 또는 r에 붙인다. join 비용이 높이 차이만큼이라 합쳐서 O(log n)
+            void split(node_ptr x, node_ptr& l, size_type& hl, node_ptr& r, size_type& hr)
+            {
+                node_ptr path[max_height];
+                bool path_left[max_height];
+                color path_color[max_height];
+                size_type depth = 0;
+                for (node_ptr node = x; node != this->end_node(); node = node->parent())
+                {
+                    path[depth] = node;
+                    path_left[depth] = tree_is_left_child<value_type>(node);
+                    path_color[depth] = node->color();
+                    depth++;
+                }
+                size_type h = black_height(x) - (x->color() == black);     // x의 두 subtree의 black height
+                l = x->_left;
+                hl = h;
+                make_root_black(l, hl);
+                r = x->_right;
+                hr = h;
+                make_root_black(r, hr);
+                for (size_type i = 1; i < depth; i++)
+                {
+                    node_ptr node = path[i];
+                    h += (path_color[i - 1] == black);
+                    size_type sub_h = h;
+                    if (path_left[i - 1])
+                    {
+                        node_ptr sub = node->_right;
+                        make_root_black(sub, sub_h);
+                        r = this->join(r, hr, node, sub, sub_h, hr);
+                    }
+                    else
+                    {
+                        node_ptr sub = node->_left;
+                        make_root_black(sub, sub_h);
+                        l = this->join(sub, sub_h, node, l, hl, hl);
+                    }
+                }
+                if (l != NULL)
+                    l->set_parent(this->end_node());
+                if (r != NULL)
+                    r->set_parent(this->end_node());
+            }
+
+            // ============================set algebra helpers============================
+            // 작은 쪽 m개를 n개짜리 트리에서 하나씩 찾는 쪽이 둘을 같이 훑고 다시 세우는 쪽보다 빠르면 true
+            // 훑기는 n개 노드를 모두 건드리고 rebuild로 한 번 더 쓰므로, n / m이 8 이상이면 찾는 쪽이 빠르다. (benchmarks/set_algebra)
+            static bool prefer_search(size_type m, size_type n)
+            {
+                return m <= n / 8;
+            }
+
+            // 걸러 낼 때 앞의 답부터 이어서 찾는 대신 root부터 찾으면 true. 답 사이가 멀면(n / m >= 512) 이어서 찾을 때
+            // 올라갔다 내려오는 길이 root부터 내려오는 길과 비슷해지고, 위쪽 노드가 cache에 남는 root 쪽이 더 빠르다.
+            static bool prefer_root_search(size_type m, size_type n)
+            {
+                return m <= n / 512;
+            }
+
+            // lower_bound(key)가 from이거나 그 뒤에 있다는 걸 알 때 from에서 찾는다.
+            // key보다 작은 노드를 따라 올라가다가 key 이상인 조상을 만나면 그 아래로 내려가므로, 답까지 d칸이면 O(log d)에 가깝다.
+            // 정렬된 key를 차례로 찾으면서 앞의 답을 from으로 넘기면 m개 전체가 O(m log(n / m))
+            template <typename Key>
+            const_node_ptr lower_bound_from(const_node_ptr from, const Key& key) const
+            {
+                if (from == this->end_node() || !this->_compare(from->_value, key))
+                    return from;
+                const_node_ptr node = from;
+                const_node_ptr pos = this->end_node();
+                while (node->parent() != this->end_node())
+                {
+                    const_node_ptr parent = node->parent();
+                    if (tree_is_left_child<value_type>(node) && !this->_compare(parent->_value, key))
+                    {
+                        pos = parent;
+                        break;
+                    }
+                    node = parent;
+                }
+                for (node = node->_right; node != NULL; )
+                {
+                    if (!this->_compare(node->_value, key))
+                    {
+                        pos = node;
+                        node = node->_left;
+                    }
+                    else
+                        node = node->_right;
+                }
+                return pos;
+            }
+
+            static void append_list(node_ptr*& tail, node_ptr node)
+            {
+                *tail = node;
+                tail = &node->_right;
+            }
+
+            // 이 트리와 other를 in-order로 같이 훑으면서 이 트리에만 있는 값, 양쪽에 있는 값(이 트리의 노드), other에만 있는 값(복사)
+            // 중 남기기로 한 것만 _right로 이어 rebuild한다. 복사하다 던지면 이어 둔 노드와 아직 안 본 노드로 트리를 세우고 다시 던진다.
+            void merge_linear(const rb_tree& other, bool keep_mine, bool keep_both, bool keep_theirs)
+            {
+                node_ptr keep = NULL;
+                node_ptr* keep_tail = &keep;
+                node_ptr doomed = NULL;
+                size_type kept = 0;
+                node_ptr node = this->_begin;
+                node_ptr next;
+                const_node_ptr theirs = other._begin;
+                try
+                {
+                    while (node != this->end_node() || theirs != other.end_node())
+                    {
+                        if (theirs == other.end_node() || (node != this->end_node() && this->_compare(node->_value, theirs->_value)))
+                        {
+                            next = tree_next<value_type>(node);
+                            if (keep_mine)
+                            {
+                                append_list(keep_tail, node);
+                                kept++;
+                            }
+                            else
+                            {
+                                node->_right = doomed;
+                                doomed = node;
+                            }
+                            node = next;
+                        }
+                        else if (node == this->end_node() || this->_compare(theirs->_value, node->_value))
+                        {
+                            if (keep_theirs)
+                            {
+                                append_list(keep_tail, this->make_node(theirs->_value));
+                                kept++;
+                            }
+                            theirs = tree_next<value_type>(theirs);
+                        }
+                        else
+                        {
+                            next = tree_next<value_type>(node);
+                            if (keep_both)
+                            {
+                                append_list(keep_tail, node);
+                                kept++;
+                            }
+                            else
+                            {
+                                node->_right = doomed;
+                                doomed = node;
+                            }
+                            node = next;
+                            theirs = tree_next<value_type>(theirs);
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    for (; node != this->end_node(); node = next)
+                    {
+                        next = tree_next<value_type>(node);
+                        append_list(keep_tail, node);
+                        kept++;
+                    }
+                    this->rebuild(keep, kept);
+                    this->free_list(doomed);
+                    throw;
+                }
+                this->rebuild(keep, kept);
+                this->free_list(doomed);
+            }
+
+            // 이 트리가 훨씬 작을 때: 노드마다 other에서 찾아 있는 것(keep_found) 또는 없는 것만 남기고 rebuild한다.
+            void filter_by(const rb_tree& other, bool keep_found)
+            {
+                node_ptr keep = NULL;
+                node_ptr* keep_tail = &keep;
+                node_ptr doomed = NULL;
+                size_type kept = 0;
+                node_ptr node = this->_begin;
+                node_ptr next;
+                const_node_ptr from = other._begin;
+                bool from_root = prefer_root_search(this->size(), other.size());
+                try
+                {
+                    for (; node != this->end_node(); node = next)
+                    {
+                        next = tree_next<value_type>(node);
+                        if (from_root)
+                            from = other.lower_bound(node->_value).base();
+                        else
+                            from = other.lower_bound_from(from, node->_value);
+                        bool found = (from != other.end_node() && !this->_compare(node->_value, from->_value));
+                        if (found == keep_found)
+                        {
+                            append_list(keep_tail, node);
+                            kept++;
+                        }
+                        else
+                        {
+                            node->_right = doomed;
+                            doomed = node;
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    for (; node != this->end_node(); node = next)
+                    {
+                        next = tree_next<value_type>(node);
+                        append_list(keep_tail, node);
+                        kept++;
+                    }
+                    this->rebuild(keep, kept);
+                    this->free_list(doomed);
+                    throw;
+                }
+                this->rebuild(keep, kept);
+                this->free_list(doomed);
+            }
+
+            // other가 훨씬 작을 때: other의 값마다 이 트리에서 찾아 있으면 지우고, 없으면 insert_missing일 때만 넣는다.
+            void erase_found(const rb_tree& other, bool insert_missing)
+            {
+                for (const_node_ptr theirs = other._begin; theirs != other.end_node(); theirs = tree_next<value_type>(theirs))
+                {
+                    if (insert_missing)
+                    {
+                        // 없으면 넣고, 이미 있으면 insert가 돌려준 노드를 지운다. 어느 쪽이든 root부터 한 번만 찾는다.
+                        ft::pair<iterator, bool> inserted = this->insert(theirs->_value);
+                        if (!inserted.second)
+                            this->erase(inserted.first);
+                        continue ;
+                    }
+                    iterator pos = this->lower_bound(theirs->_value);
+                    if (pos != this->end() && !this->_compare(theirs->_value, *pos))
+                        this->erase(pos);
+                }
+            }
+
+            // list(_right로 이어진 in-order 노드들)의 앞 n개로 bulk_load와 같은 모양과 색의 트리를 만든다.
+            node_ptr build_from_list(node_ptr& list, size_type n, size_type depth, size_type red_depth)
+            {
+                if (n == 0)
+                    return NULL;
+                size_type left_size = (n - 1) / 2;
+                node_ptr left = this->build_from_list(list, left_size, depth + 1, red_depth);
+                node_ptr node = list;
+                list = list->_right;
+                node->_left = left;
+                if (left != NULL)
+                    left->set_parent(node);
+                node->set_color((depth == red_depth) ? red : black);
+                node->_right = this->build_from_list(list, n - 1 - left_size, depth + 1, red_depth);
+                if (node->_right != NULL)
+                    node->_right->set_parent(node);
+                this->update_count(node);
+                return node;
+            }
+
+            // list의 노드 n개로 트리 전체를 다시 세운다.
+            void rebuild(node_ptr list, size_type n)
+            {
+                size_type height = 0;
+                for (size_type m = n; m > 0; m >>= 1)
+                    height++;
+                this->root() = this->build_from_list(list, n, 1, (height > 1) ? height : 0);
+                this->_size = n;
+                this->_size_known = true;
+                this->_parent.thread_ends(NULL, NULL);
+                if (this->root() == NULL)
+                {
+                    this->_begin = this->end_node();
+                    this->_last = this->end_node();
+                    return ;
+                }
+                this->root()->set_parent(this->end_node());
+                this->_begin = tree_min<value_type>(this->root());
+                this->_last = tree_max<value_type>(this->root());
+                this->link_threads();
             }
 
             void destroy(node_ptr node)
@@ -634,9 +2306,52 @@ namespace ft
             node_ptr get_sibling(node_ptr node) const
             {
                 if (tree_is_left_child<value_type>(node))
-                    return node->_parent->_right;
+                    return node->parent()->_right;
                 else
-                    return node->_parent->_left;
+                    return node->parent()->_left;
+            }
+
+            // subtree 크기(_count)를 다루는 함수들. FT_RB_TREE_ORDER_STATISTICS가 없으면 아무 일도 하지 않는다.
+            static size_type subtree_size(const_node_ptr node)
+            {
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+                return (node == NULL) ? 0 : node->_count;
+#else
+                (void)node;
+                return 0;
+#endif
+            }
+
+            // 자식들의 크기가 맞을 때 node의 크기를 다시 계산한다. (회전, bulk build, copy)
+            void update_count(node_ptr node)
+            {
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+                node->_count = 1 + subtree_size(node->_left) + subtree_size(node->_right);
+#else
+                (void)node;
+#endif
+            }
+
+            // node부터 root까지 subtree 크기에 delta를 더한다. (노드가 붙거나 빠지는 자리의 조상들)
+            void add_count_upward(node_ptr node, difference_type delta)
+            {
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+                for (; node != this->end_node(); node = node->parent())
+                    node->_count += delta;
+#else
+                (void)node;
+                (void)delta;
+#endif
+            }
+
+            void copy_count(node_ptr to, const_node_ptr from)
+            {
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+                to->_count = from->_count;
+#else
+                (void)to;
+                (void)from;
+#endif
             }
 
             color get_node_color(node_ptr node)
@@ -644,7 +2359,7 @@ namespace ft
                 if (node == NULL)
                     return (black);
                 else
-                    return (node->_color);
+                    return (node->color());
             }
 
             void rotate_left(node_ptr node)
@@ -652,14 +2367,16 @@ namespace ft
                 node_ptr right_node = node->_right;
                 node->_right = right_node->_left;
                 if (node->_right != NULL)
-                    node->_right->_parent = node;
-                right_node->_parent = node->_parent;
+                    node->_right->set_parent(node);
+                right_node->set_parent(node->parent());
                 if (tree_is_left_child<value_type>(node))
-                    node->_parent->_left = right_node;
+                    node->parent()->_left = right_node;
                 else
-                    node->_parent->_right = right_node;
+                    node->parent()->_right = right_node;
                 right_node->_left = node;
-                node->_parent = right_node;
+                node->set_parent(right_node);
+                this->update_count(node);
+                this->update_count(right_node);
             }
 
             void rotate_right(node_ptr node)
@@ -667,39 +2384,41 @@ namespace ft
                 node_ptr left_node = node->_left;
                 node->_left = left_node->_right;
                 if (node->_left != NULL)
-                    node->_left->_parent = node;
-                left_node->_parent = node->_parent;
+                    node->_left->set_parent(node);
+                left_node->set_parent(node->parent());
                 if (tree_is_left_child<value_type>(node))
-                    node->_parent->_left = left_node;
+                    node->parent()->_left = left_node;
                 else
-                    node->_parent->_right = left_node;
+                    node->parent()->_right = left_node;
                 left_node->_right = node;
-                node->_parent = left_node;
+                node->set_parent(left_node);
+                this->update_count(node);
+                this->update_count(left_node);
             }
 
             void insert_sort(node_ptr node)
             {
-                while (node != this->root() && get_node_color(node->_parent) == red)
+                while (node != this->root() && get_node_color(node->parent()) == red)
                 {
-                    node_ptr uncle = this->get_sibling(node->_parent);
+                    node_ptr uncle = this->get_sibling(node->parent());
                     if (this->get_node_color(uncle) == red)
                     {
                         uncle->change_color();
-                        node = node->_parent;
+                        node = node->parent();
                         node->change_color();
-                        node = node->_parent;
+                        node = node->parent();
                         node->change_color();
                     }
-                    else if (tree_is_left_child<value_type>(node->_parent))
+                    else if (tree_is_left_child<value_type>(node->parent()))
                     {
                         if (!tree_is_left_child<value_type>(node))
                         {
-                            node = node->_parent;
+                            node = node->parent();
                             this->rotate_left(node);
                         }
-                        node = node->_parent;
+                        node = node->parent();
                         node->change_color();
-                        node = node->_parent;
+                        node = node->parent();
                         node->change_color();
                         this->rotate_right(node);
                         break ;
@@ -708,12 +2427,12 @@ namespace ft
                     {
                         if (tree_is_left_child<value_type>(node))
                         {
-                            node = node->_parent;
+                            node = node->parent();
                             this->rotate_right(node);
                         }
-                        node = node->_parent;
+                        node = node->parent();
                         node->change_color();
-                        node = node->_parent;
+                        node = node->parent();
                         node->change_color();
                         this->rotate_left(node);
                         break ;
@@ -732,45 +2451,47 @@ namespace ft
             void erase(node_ptr root, node_ptr node)
             {
                 node_ptr rep_node = replace_node(node);
+                this->add_count_upward(rep_node->parent(), -1);     //rep_node가 빠지는 자리부터 root까지 subtree 크기를 줄인다
                 node_ptr rep_child = rep_node->_left == NULL ? rep_node->_right : rep_node->_left;   //rep_node의 자식(자식은 0개 혹은 1개일 수 밖에 없기 떄문)
                 node_ptr sibling = NULL;
 
                 if (rep_child != NULL)                          //rep_node의 자리를 대체해야 하기 때문에 rep_child는 rep_node의 부모를 가리키게 한다. (자식이 없을 경우 x)
-                    rep_child->_parent = rep_node->_parent;
+                    rep_child->set_parent(rep_node->parent());
                 if (tree_is_left_child<value_type>(rep_node))   //rep_node가 parent의 왼쪽일때
                 {
-                    rep_node->_parent->_left = rep_child;     //rep_node의 부모도 rep_child를 가리키게 한다
+                    rep_node->parent()->_left = rep_child;     //rep_node의 부모도 rep_child를 가리키게 한다
                     if (rep_node == root)                       //rep_node가 root일 떄 예외처리
                         root = rep_child;
                     else
-                        sibling = rep_node->_parent->_right;
+                        sibling = rep_node->parent()->_right;
                 }
                 else                                            //rep_node가 parent의 오른쪽일때
                 {
-                    rep_node->_parent->_right = rep_child;
-                    sibling = rep_node->_parent->_left;
+                    rep_node->parent()->_right = rep_child;
+                    sibling = rep_node->parent()->_left;
                 }
-                color rep_color = rep_node->_color;
+                color rep_color = rep_node->color();
                 if (rep_node != node)                           //node의 자식이 2개일때 (replace_node()함수의 else문 일때만) rep_node의 요소 저장
                 {
-                    rep_node->_parent = node->_parent;
+                    rep_node->set_parent(node->parent());
                     if (tree_is_left_child<value_type>(node))   //node->parent에서 rep_node로 연결
-                        rep_node->_parent->_left = rep_node;
+                        rep_node->parent()->_left = rep_node;
                     else
-                        rep_node->_parent->_right = rep_node;
+                        rep_node->parent()->_right = rep_node;
                     rep_node->_left = node->_left;            //node의 자식들과 rep_node를 연결한다.
-                    rep_node->_left->_parent = rep_node;
+                    rep_node->_left->set_parent(rep_node);
                     rep_node->_right = node->_right;
                     if (rep_node->_right != NULL)
-                        rep_node->_right->_parent = rep_node;
-                    rep_node->_color = node->_color;          //node에 맞게 rep_node 색 변경
+                        rep_node->_right->set_parent(rep_node);
+                    rep_node->set_color(node->color());          //node에 맞게 rep_node 색 변경
+                    this->copy_count(rep_node, node);
                     if (node == root)
                         root = rep_node;
                 }
                 if (rep_color == black && root != NULL) //black + root, red + root, red + non-root 모두 해당되지 않음 (규칙 5에 어긋나지 않음)
                 {
                     if (rep_child != NULL)          //자식을 black으로 바꿔서 black level 유지. (규칙 5)
-                        rep_child->_color = black;
+                        rep_child->set_color(black);
                     else
                         erase_sort(root, rep_child, sibling);  //자식이 없을 때는 추가 조치
                 }
@@ -785,8 +2506,8 @@ namespace ft
                         if (get_node_color(sibling) == red)
                         {
                             sibling->change_color();
-                            sibling->_parent->change_color();
-                            rotate_left(sibling->_parent);
+                            sibling->parent()->change_color();
+                            rotate_left(sibling->parent());
                             if (root == sibling->_left)
                                 root = sibling;
                             sibling = sibling->_left->_right;
@@ -794,10 +2515,10 @@ namespace ft
                         if (get_node_color(sibling->_left) == black && get_node_color(sibling->_right) == black)
                         {
                             sibling->change_color();
-                            node = sibling->_parent;
+                            node = sibling->parent();
                             if (node == root || get_node_color(node) == red)
                             {
-                                node->_color = black;
+                                node->set_color(black);
                                 break;
                             }
                             sibling = get_sibling(node);
@@ -809,12 +2530,12 @@ namespace ft
                                 sibling->_left->change_color();
                                 sibling->change_color();
                                 rotate_right(sibling);
-                                sibling = sibling->_parent;
+                                sibling = sibling->parent();
                             }
-                            sibling->_color = sibling->_parent->_color;
-                            sibling->_parent->_color = black;
-                            sibling->_right->_color = black;
-                            rotate_left(sibling->_parent);
+                            sibling->set_color(sibling->parent()->color());
+                            sibling->parent()->set_color(black);
+                            sibling->_right->set_color(black);
+                            rotate_left(sibling->parent());
                             break;
                         }
                     }
@@ -823,8 +2544,8 @@ namespace ft
                         if (get_node_color(sibling) == red)
                         {
                             sibling->change_color();
-                            sibling->_parent->change_color();
-                            rotate_right(sibling->_parent);
+                            sibling->parent()->change_color();
+                            rotate_right(sibling->parent());
                             if (root == sibling->_right)
                                 root = sibling;
                             sibling = sibling->_right->_left;
@@ -832,10 +2553,10 @@ namespace ft
                         if (get_node_color(sibling->_left) == black && get_node_color(sibling->_right) == black)
                         {
                             sibling->change_color();
-                            node = sibling->_parent;
+                            node = sibling->parent();
                             if (node == root || get_node_color(node) == red)
                             {
-                                node->_color = black;
+                                node->set_color(black);
                                 break;
                             }
                             sibling = get_sibling(node);
@@ -847,12 +2568,12 @@ namespace ft
                                 sibling->_right->change_color();
                                 sibling->change_color();
                                 rotate_left(sibling);
-                                sibling = sibling->_parent;
+                                sibling = sibling->parent();
                             }
-                            sibling->_color = sibling->_parent->_color;
-                            sibling->_parent->_color = black;
-                            sibling->_left->_color = black;
-                            rotate_right(sibling->_parent);
+                            sibling->set_color(sibling->parent()->color());
+                            sibling->parent()->set_color(black);
+                            sibling->_left->set_color(black);
+                            rotate_right(sibling->parent());
                             break;
                         }
                     }
@@ -0,0 +1,174 @@
+#ifndef RECLAIMER_HPP
+#define RECLAIMER_HPP
+
+#include <pthread.h>
+#include <sched.h>
+#include <cstddef>
+#include <new>
+#include "type_traits.hpp"
+
+namespace ft
+{
+    // ============================================reclaimer============================================
+    // 큰 컨테이너의 해제(원소 소멸자 + 노드/buffer 반납)를 맡아서 처리하는 background thread 하나.
+    // 일을 넘기는 쪽은 job을 queue에 넣기만 하고 바로 돌아가므로, 수백만 개짜리 map이나 vector를 버려도 멈추지 않는다.
+    // thread는 처음 push할 때 만들어지고 프로세스가 끝날 때까지 남는다. 끝날 때 queue에 남은 job은 실행되지 않을 수 있으므로
+    // 소멸자에서 해야 할 일이 있는 원소라면 종료 전에 wait()를 부른다.
+    class reclaimer
+    {
+        public:
+            typedef void (*job_func)(void*);
+
+        private:
+            struct job
+            {
+                job_func    func;
+                void*       arg;
+                job*        next;
+            };
+
+            pthread_mutex_t _lock;
+            pthread_cond_t  _has_work;
+            pthread_cond_t  _idle;
+            job*            _head;
+            job*            _tail;
+            bool            _running;   // 지금 job 하나를 실행하는 중
+            bool            _started;
+
+            reclaimer(): _head(NULL), _tail(NULL), _running(false), _started(false)
+            {
+                pthread_mutex_init(&_lock, NULL);
+                pthread_cond_init(&_has_work, NULL);
+                pthread_cond_init(&_idle, NULL);
+            }
+            reclaimer(const reclaimer&);
+            reclaimer& operator=(const reclaimer&);
+
+        public:
+            // 종료 중에도 thread가 mutex를 쓰고 있을 수 있으므로 일부러 소멸시키지 않는다.
+            static reclaimer& instance()
+            {
+                static reclaimer* global = new reclaimer();
+                return *global;
+            }
+
+            // func(arg)를 background thread에서 실행한다. thread를 만들 수 없으면 여기서 바로 실행한다.
+            void push(job_func func, void* arg)
+            {
+                job* new_job = new job();
+                new_job->func = func;
+                new_job->arg = arg;
+                new_job->next = NULL;
+                pthread_mutex_lock(&_lock);
+                if (!_started)
+                {
+                    pthread_t thread;
+                    _started = (pthread_create(&thread, NULL, &reclaimer::run, this) == 0);
+                    if (_started)
+                        pthread_detach(thread);
+                }
+                if (!_started)
+                {
+                    pthread_mutex_unlock(&_lock);
+                    delete new_job;
+                    func(arg);
+                    return ;
+                }
+                if (_tail == NULL)
+                    _head = new_job;
+                else
+                    _tail->next = new_job;
+                _tail = new_job;
+                pthread_cond_signal(&_has_work);
+                pthread_mutex_unlock(&_lock);
+            }
+
+            // 지금까지 넣은 job이 모두 끝날 때까지 기다린다.
+            void wait()
+            {
+                pthread_mutex_lock(&_lock);
+                while (_head != NULL || _running)
+                    pthread_cond_wait(&_idle, &_lock);
+                pthread_mutex_unlock(&_lock);
+            }
+
+        private:
+            // CPU가 하나뿐이면 push가 깨운 이 thread가 부른 쪽을 밀어내고 해제를 시작해서, 부른 쪽이 수 ms씩 멈춘다.
+            // 할 일이 없는 CPU에서만 돌도록 SCHED_IDLE로 내린다. CPU가 계속 바쁘면 해제가 늦어지고, wait()는 부른 쪽이 쉬는 동안 끝난다.
+            // (Linux 전용, 권한 없이 된다. 안 되면 그냥 둔다)
+            void lower_priority()
+            {
+#ifdef SCHED_IDLE
+                struct sched_param param;
+                param.sched_priority = 0;
+                pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+            }
+
+            static void* run(void* arg)
+            {
+                reclaimer* self = static_cast<reclaimer*>(arg);
+                self->lower_priority();
+                pthread_mutex_lock(&self->_lock);
+                while (true)
+                {
+                    while (self->_head == NULL)
+                        pthread_cond_wait(&self->_has_work, &self->_lock);
+                    job* next = self->_head;
+                    self->_head = next->next;
+                    if (self->_head == NULL)
+                        self->_tail = NULL;
+                    self->_running = true;
+                    pthread_mutex_unlock(&self->_lock);
+                    next->func(next->arg);
+                    delete next;
+                    pthread_mutex_lock(&self->_lock);
+                    self->_running = false;
+                    if (self->_head == NULL)
+                        pthread_cond_broadcast(&self->_idle);
+                }
+                return NULL;
+            }
+    };
+
+    template <typename Container>
+    void reclaim_delete(void* container)
+    {
+        delete static_cast<Container*>(container);
+    }
+
+    template <typename Container>
+    void reclaim(Container& c, ft::true_type)
+    {
+        Container* doomed = new Container();
+        doomed->swap(c);
+        try
+        {
+            reclaimer::instance().push(&reclaim_delete<Container>, doomed);
+        }
+        catch (const std::bad_alloc&)
+        {
+            delete doomed;
+        }
+    }
+
+    // allocator를 다른 thread에서 쓰면 안 되면(pool_allocator) 여기서 바로 해제한다.
+    template <typename Container>
+    void reclaim(Container& c, ft::false_type)
+    {
+        Container().swap(c);
+    }
+
+    // Releases all the elements and storage of c as if by Container().swap(c),
+    // but the old contents are destroyed on the reclaimer thread instead of the calling thread.
+    //   ft::reclaim(vector_buffer);     // ft::vector<Buffer>().swap(vector_buffer) 대신
+    // 원소의 소멸자가 다른 thread에서 불리므로, 소멸자가 다른 thread와 공유하는 상태를 건드리면 안 된다.
+    // allocator_is_thread_safe가 false인 allocator를 쓰는 컨테이너는 그냥 여기서 해제한다.
+    template <typename Container>
+    void reclaim(Container& c)
+    {
+        ft::reclaim(c, typename ft::bool_type<ft::allocator_is_thread_safe<typename Container::allocator_type>::value>::type());
+    }
+}
+
+#endif
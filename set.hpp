@@ -40,6 +40,14 @@ namespace ft
                     _tree = x._tree;
                 return (*this);
             }
+#if __cplusplus >= 201103L
+            set (set&& x): _tree(std::move(x._tree)) {}
+            set& operator=(set&& x)
+            {
+                _tree = std::move(x._tree);
+                return (*this);
+            }
+#endif
 
             // ============================================Iterators============================================
             iterator begin() { return (_tree.begin()); }
@@ -53,30 +61,59 @@ namespace ft
         
             // =============================================Capacity=============================================
             bool empty() const { return (_tree.empty()); }
+            // O(1), except the first call after split or join without FT_RB_TREE_ORDER_STATISTICS (see split).
             size_type size() const { return (_tree.size()); }
             size_type max_size() const { return (_tree.max_size()); }
 
             // =============================================Modifiers=============================================
             ft::pair<iterator, bool> insert(const value_type& x) { return (_tree.insert(x)); }
-            iterator insert(iterator position, const value_type& x)
-            {
-                (void)position;
-                return (_tree.insert(x).first);
-            }
+            iterator insert(iterator position, const value_type& x) { return (_tree.insert(position, x)); }
+#if __cplusplus >= 201103L
+            ft::pair<iterator, bool> insert(value_type&& x) { return (_tree.insert(std::move(x))); }
+            iterator insert(iterator position, value_type&& x) { return (_tree.insert(position, std::move(x))); }
+            template <typename... Args>
+            ft::pair<iterator, bool> emplace(Args&&... args) { return (_tree.emplace(std::forward<Args>(args)...)); }
+            template <typename... Args>
+            iterator emplace_hint(iterator position, Args&&... args) { return (_tree.emplace_hint(position, std::forward<Args>(args)...)); }
+#endif
             template <typename InputIterator>
             void insert(InputIterator first, InputIterator last) { _tree.insert(first, last); }
             void erase(iterator position){ _tree.erase(*position); }
             size_type erase(const key_type& x) { return (_tree.erase(x)); }
-            void erase(iterator first, iterator last)
-            { 
-                while (first != last)
-                    _tree.erase(*(first++));
-            }
+            // Removes the elements in [first, last). O(log n + k) for k removed elements: the tree is split and rejoined
+            // in O(log n), and each removed element still has to be destroyed.
+            void erase(iterator first, iterator last) { _tree.erase(first, last); }
+            // Removes all elements for which pred(element) returns true and returns how many were removed.
+            template <typename Predicate>
+            size_type erase_if(Predicate pred) { return _tree.erase_if(pred); }
             void swap(set& x) { _tree.swap(x._tree); }
             void clear() { _tree.clear(); }
+            // Empties the set at once and frees the removed nodes over several calls. The first call takes every node out,
+            // so the set is empty (and usable) right away; each call then frees or unlinks at most budget nodes.
+            // Returns true when nothing is left to free.
+            bool clear_some(size_type budget) { return _tree.clear_some(budget); }
+            // Moves every element whose key is not less than k into x, replacing the previous contents of x.
+            // O(log n). x takes the comparison object and allocator of the container, so the nodes are always handed over
+            // without copying or allocating, even with pool_allocator. Without FT_RB_TREE_ORDER_STATISTICS the sizes of the
+            // two parts are only counted right away when the cut is near either end; otherwise the first size() of each
+            // part counts its elements (linear in that part).
+            void split(const key_type& k, set& x) { _tree.split(k, x._tree); }
+            // Moves every element of x into the container and leaves x empty. Either all keys of x must be greater than
+            // all keys of the container or all less; otherwise std::invalid_argument is thrown and both are left unchanged.
+            // O(log n) when the allocators compare equal. If they compare unequal (pool_allocator) the nodes cannot change owner:
+            // the elements of x are copied into the container one by one, O(m log(n + m)) for m elements of x, and x is
+            // cleared afterwards. If a copy throws, the elements copied so far stay in the container and x is unchanged.
+            void join(set& x) { _tree.join(x._tree); }
+            // Replaces the contents with their union / intersection / difference / symmetric difference with x.
+            // When a key is in both, the element of this set is kept. Linear in size() + x.size(); when one side is
+            // at least 8 times smaller (m elements against n) its elements are looked up one by one instead, in O(m log n).
+            void merge_union(const set& x) { _tree.merge_union(x._tree); }
+            void merge_intersection(const set& x) { _tree.merge_intersection(x._tree); }
+            void merge_difference(const set& x) { _tree.merge_difference(x._tree); }
+            void merge_symmetric_difference(const set& x) { _tree.merge_symmetric_difference(x._tree); }
 
             // =============================================Observers=============================================
-            key_compare key_comp() const { return (key_compare()); }
+            key_compare key_comp() const { return (_tree.value_comp()); }
             value_compare value_comp() const { return (_tree.value_comp()); }
 
             // =============================================Operations=============================================
@@ -90,6 +127,37 @@ namespace ft
             ft::pair<iterator,iterator> equal_range(const key_type& x) { return (_tree.equal_range(x)); }
             ft::pair<const_iterator,const_iterator> equal_range(const key_type& x) const { return (_tree.equal_range(x)); }
 
+            // transparent comparator(ft::less<> 등)일 때만 쓸 수 있는 key_type 이외의 타입으로 검색하는 overload
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type find(const K& x) { return (_tree.find(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type find(const K& x) const { return (_tree.find(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, size_type>::type count(const K& x) const { return (_tree.count(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type lower_bound(const K& x) { return (_tree.lower_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type lower_bound(const K& x) const { return (_tree.lower_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, iterator>::type upper_bound(const K& x) { return (_tree.upper_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, const_iterator>::type upper_bound(const K& x) const { return (_tree.upper_bound(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, ft::pair<iterator, iterator> >::type equal_range(const K& x) { return (_tree.equal_range(x)); }
+            template <typename K>
+            typename ft::enable_if_transparent<key_compare, K, ft::pair<const_iterator, const_iterator> >::type equal_range(const K& x) const { return (_tree.equal_range(x)); }
+
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+            // ==========================================Order statistics==========================================
+            // FT_RB_TREE_ORDER_STATISTICS로 컴파일했을 때만 있다. 모두 O(log n)
+            iterator select(size_type k) { return (_tree.select(k)); }
+            const_iterator select(size_type k) const { return (_tree.select(k)); }
+            size_type rank(const key_type& x) const { return (_tree.rank(x)); }
+            size_type count_range(const key_type& lo, const key_type& hi) const { return (_tree.count_range(lo, hi)); }
+            size_type index(const_iterator position) const { return (_tree.index(position)); }
+            difference_type distance(const_iterator first, const_iterator last) const { return (_tree.distance(first, last)); }
+#endif
+
             // =============================================Allocator=============================================
             allocator_type get_allocator() const { return _tree.get_allocator(); }
     };
@@ -126,6 +194,10 @@ namespace ft
     template <class Key_, class Compare_, class Alloc>
     void swap(ft::set<Key_,  Compare_, Alloc>& x, ft::set<Key_,  Compare_, Alloc>& y) 
     { x.swap(y); }
+
+    template <class Key_, class Compare_, class Alloc, class Predicate>
+    typename ft::set<Key_, Compare_, Alloc>::size_type erase_if(ft::set<Key_, Compare_, Alloc>& c, Predicate pred)
+    { return c.erase_if(pred); }
 }
 
 #endif
\ No newline at end of file
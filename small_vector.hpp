@@ -0,0 +1,560 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <cstring>
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "random_access_iterator.hpp"
+#include "reverse_iterator.hpp"
+
+namespace ft
+{
+    // vector와 같은 인터페이스를 가지고, 원소 N개까지는 객체 안의 배열(_inline)에 두는 vector.
+    // N개를 넘을 때 처음으로 allocator에서 할당하고(capacity N * 2), 그 뒤로는 vector처럼 두 배씩 늘린다.
+    // 원소가 객체 안에 있을 수 있으므로 swap은 둘 다 heap에 있을 때만 포인터를 바꾸고, 그 밖에는 원소를 옮긴다.
+    template <typename T, std::size_t N, typename Allocator = std::allocator<T> >
+    class small_vector
+    {
+        private:
+            typedef small_vector<T, N, Allocator> vector_type;
+        public:
+            typedef T                                                               value_type;
+            typedef Allocator                                                       allocator_type;
+            typedef typename allocator_type::reference                              reference;
+            typedef typename allocator_type::const_reference                        const_reference;
+            typedef typename allocator_type::pointer                                pointer;
+            typedef typename allocator_type::const_pointer                          const_pointer;
+            typedef ft::random_access_iterator<pointer, vector_type>				iterator;
+            typedef ft::random_access_iterator<const_pointer, vector_type>			const_iterator;
+            typedef typename ft::reverse_iterator<iterator>							reverse_iterator;
+            typedef typename ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+            typedef std::ptrdiff_t													difference_type;
+            typedef std::size_t														size_type;
+
+            static const size_type  inline_capacity = N;
+
+        protected:
+            allocator_type  _alloc;
+            pointer         _start;
+            pointer         _end;
+            pointer         _end_capacity;
+            // 원소는 construct로 만든다. 정렬을 맞추기 위해 union으로 둔다. (btree_node의 _slots와 같다)
+            // 크기가 0인 배열은 쓸 수 없으므로 N == 0이어도 한 칸은 잡아 두지만, inline_capacity는 N 그대로다.
+            union
+            {
+                char        _bytes[sizeof(value_type) * (N ? N : 1)];
+                void*       _align_pointer;
+                long        _align_long;
+                long double _align_long_double;
+            }               _inline;
+
+        public:
+            // (1) empty container constructor (default constructor)
+            // Constructs an empty container, with no elements. 할당하지 않는다.
+            explicit small_vector (const allocator_type& alloc = allocator_type()): _alloc(alloc)
+            {
+                this->reset_inline();
+            }
+
+            // (2) fill constructor
+            // Constructs a container with n elements. Each element is a copy of val.
+            explicit small_vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()): _alloc(alloc)
+            {
+                this->reset_inline();
+                this->insert(this->end(), n, val);
+            }
+
+            // (3) range constructor
+            // Constructs a container with as many elements as the range [first,last), with each element constructed from its corresponding element in that range, in the same order.
+            template <class InputIterator>
+            small_vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+                        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0): _alloc(alloc)
+            {
+                this->reset_inline();
+                this->insert(this->end(), first, last);
+            }
+
+            // (4) copy constructor
+            // Constructs a container with a copy of each of the elements in x, in the same order.
+            small_vector (const small_vector& x): _alloc(x._alloc)
+            {
+                this->reset_inline();
+                this->insert(this->end(), x.begin(), x.end());
+            }
+
+            ~small_vector()
+            {
+                this->clear();
+                this->release();
+            }
+
+            // Copies all the elements from x into the container. 이미 있는 공간에 들어가면 새로 할당하지 않는다.
+            small_vector& operator= (const small_vector& x)
+            {
+                if (this != &x)
+                    this->assign(x.begin(), x.end());
+                return *this;
+            }
+
+#if __cplusplus >= 201103L
+            // (5) move constructor (C++11)
+            // x가 heap에 있으면 buffer를 가져오고, 객체 안에 있으면 원소를 하나씩 옮긴다. x는 비게 된다.
+            small_vector (small_vector&& x): _alloc(x._alloc)
+            {
+                this->reset_inline();
+                this->take(x);
+            }
+
+            small_vector& operator= (small_vector&& x)
+            {
+                if (this != &x)
+                {
+                    this->clear();
+                    this->release();
+                    this->reset_inline();
+                    this->take(x);
+                }
+                return *this;
+            }
+#endif
+
+            // ============================================Iterators============================================
+            iterator begin() { return iterator(this->_start); }
+            const_iterator begin() const { return const_iterator(this->_start); }
+            iterator end() { return iterator(this->_end); }
+            const_iterator end() const { return const_iterator(this->_end); }
+            reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+            const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+            reverse_iterator rend() { return reverse_iterator(this->begin()); }
+            const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+            // =============================================Capacity=============================================
+            size_type size() const { return size_type(this->_end - this->_start); }
+            size_type max_size() const { return (this->_alloc.max_size()); }
+
+            void resize (size_type n, value_type val = value_type())
+            {
+                if (n > this->max_size())
+                    throw std::out_of_range("small_vector::resize");
+                if (n < this->size())
+                    this->erase(this->begin() + n, this->end());
+                else
+                    this->insert(this->end(), n - this->size(), val);
+            }
+
+            size_type capacity() const { return size_type(this->_end_capacity - this->_start); }
+            bool empty() const { return this->_start == this->_end; }
+
+            // 원소가 객체 안의 배열에 있는지 (한 번도 N개를 넘지 않았으면 true)
+            bool is_inline() const { return this->_start == this->inline_data(); }
+
+            // Requests that the capacity be at least enough to contain n elements.
+            void reserve (size_type n)
+            {
+                if (n > this->max_size())
+                    throw std::out_of_range("small_vector::reserve");
+                if (n > this->capacity())
+                    this->reallocate(n);
+            }
+
+            // ===========================================Element access===========================================
+            reference operator[] (size_type n) { return this->_start[n]; }
+            const_reference operator[] (size_type n) const { return this->_start[n]; }
+            reference at (size_type n)
+            {
+                if (n >= this->size())
+                    throw std::out_of_range("ft::small_vector");
+                return this->_start[n];
+            }
+            const_reference at (size_type n) const
+            {
+                if (n >= this->size())
+                    throw std::out_of_range("ft::small_vector");
+                return this->_start[n];
+            }
+            reference front() { return *this->_start; }
+            const_reference front() const { return *this->_start; }
+            reference back() { return *(this->_end - 1); }
+            const_reference back() const { return *(this->_end - 1); }
+
+            // ===========================================Modifiers===========================================
+            template <class InputIterator>
+            void assign (InputIterator first, InputIterator last,
+                            typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
+            {
+                this->clear();
+                this->insert(this->end(), first, last);
+            }
+
+            void assign (size_type n, const value_type& val)
+            {
+                value_type copy(val);
+                this->clear();
+                this->insert(this->end(), n, copy);
+            }
+
+            void push_back (const value_type& val)
+            {
+                if (this->_end == this->_end_capacity)
+                {
+                    // val이 기존 원소일 수도 있으므로 옮기기 전에 복사해 둔다.
+                    value_type copy(val);
+                    // N == 0이면 capacity가 0에서 시작하므로 open_gap처럼 최소 하나는 늘린다.
+                    size_type next_capacity = this->capacity() * 2;
+                    if (next_capacity < this->size() + 1)
+                        next_capacity = this->size() + 1;
+                    this->reallocate(next_capacity);
+                    this->_alloc.construct(this->_end, copy);
+                }
+                else
+                    this->_alloc.construct(this->_end, val);
+                ++this->_end;
+            }
+
+#if __cplusplus >= 201103L
+            void push_back (value_type&& val) { this->emplace_back(std::move(val)); }
+
+            // Inserts a new element at the end of the small_vector, constructed in place using args as the arguments for its constructor.
+            template <typename... Args>
+            void emplace_back (Args&&... args)
+            {
+                if (this->_end == this->_end_capacity)
+                {
+                    // args가 기존 원소를 가리킬 수도 있으므로 옮기기 전에 만들어 둔다.
+                    value_type tmp(std::forward<Args>(args)...);
+                    size_type next_capacity = this->capacity() * 2;
+                    if (next_capacity < this->size() + 1)
+                        next_capacity = this->size() + 1;
+                    this->reallocate(next_capacity);
+                    this->_alloc.construct(this->_end, std::move(tmp));
+                }
+                else
+                    this->_alloc.construct(this->_end, std::forward<Args>(args)...);
+                ++this->_end;
+            }
+#endif
+
+            void pop_back()
+            {
+                if (!this->empty())
+                    this->_alloc.destroy(--this->_end);
+            }
+
+            // single element (1)
+            iterator insert (iterator position, const value_type& val)
+            {
+                size_type n = position - this->begin();
+                this->insert(position, 1, val);
+                return this->begin() + n;
+            }
+
+            // fill (2)
+            void insert (iterator position, size_type n, const value_type& val)
+            {
+                if (n == 0)
+                    return ;
+                value_type copy(val);
+                pointer gap = this->open_gap(position - this->begin(), n);
+                for (size_type i = 0; i < n; i++)
+                    this->_alloc.construct(gap + i, copy);
+                this->_end += n;
+            }
+
+            // range (3)
+            template <class InputIterator>
+            void insert (iterator position, InputIterator first, InputIterator last,
+                            typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+            {
+                this->range_insert(position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+            }
+
+            iterator erase (iterator position) { return this->erase(position, position + 1); }
+
+            iterator erase (iterator first, iterator last)
+            {
+                pointer p_first = this->_start + (first - this->begin());
+                pointer p_last = this->_start + (last - this->begin());
+                for (pointer p = p_first; p != p_last; p++)
+                    this->_alloc.destroy(p);
+                this->relocate(p_first, p_last, this->_end - p_last);
+                this->_end -= (p_last - p_first);
+                return iterator(p_first);
+            }
+
+            // 둘 다 heap에 있으면 포인터만 바꾼다.
+            // 둘 다 객체 안에 있으면 겹치는 앞부분은 원소끼리 바꾸고 남는 뒷부분만 옮긴다.
+            // 한쪽만 heap에 있으면 객체 안의 원소를 상대의 비어 있는 inline 배열로 옮기고 heap buffer를 넘겨준다.
+            void swap (small_vector& x)
+            {
+                if (&x == this)
+                    return ;
+                if (!this->is_inline() && !x.is_inline())
+                {
+                    ft::swap(this->_start, x._start);
+                    ft::swap(this->_end, x._end);
+                    ft::swap(this->_end_capacity, x._end_capacity);
+                    ft::swap(this->_alloc, x._alloc);
+                }
+                else if (this->is_inline() && x.is_inline())
+                {
+                    small_vector& longer = this->size() < x.size() ? x : *this;
+                    small_vector& shorter = this->size() < x.size() ? *this : x;
+                    size_type common = shorter.size();
+                    size_type extra = longer.size() - common;
+                    for (size_type i = 0; i < common; i++)
+                    {
+                        value_type tmp(FT_MOVE(this->_start[i]));
+                        this->_start[i] = FT_MOVE(x._start[i]);
+                        x._start[i] = FT_MOVE(tmp);
+                    }
+                    this->relocate(shorter._end, longer._start + common, extra);
+                    shorter._end += extra;
+                    longer._end -= extra;
+                }
+                else if (this->is_inline())
+                    this->swap_with_heap(x);
+                else
+                    x.swap_with_heap(*this);
+            }
+
+            // Removes all elements, leaving the container with a size of 0. 할당한 공간은 남겨 둔다.
+            void clear()
+            {
+                while (this->_start != this->_end)
+                    this->_alloc.destroy(--this->_end);
+            }
+
+            allocator_type get_allocator() const { return this->_alloc; }
+
+        private:
+            pointer inline_data() { return reinterpret_cast<pointer>(this->_inline._bytes); }
+            const_pointer inline_data() const { return reinterpret_cast<const_pointer>(this->_inline._bytes); }
+
+            // input iterator는 한 번밖에 못 읽으므로 길이를 세지 않는다. 끝이면 push_back, 중간이면 모아 둔 뒤 넣는다.
+            template <class InputIterator>
+            void range_insert(iterator position, InputIterator first, InputIterator last, ft::input_iterator_tag)
+            {
+                if (position == this->end())
+                {
+                    for (; first != last; ++first)
+                        this->push_back(*first);
+                    return ;
+                }
+                small_vector values;
+                for (; first != last; ++first)
+                    values.push_back(*first);
+                this->range_insert(position, values.begin(), values.end(), ft::random_access_iterator_tag());
+            }
+
+            // vector::range_insert처럼 공간이 있으면 그 자리에 만들고, 없으면 새 buffer에 먼저 만든 뒤 기존 원소를 옮긴다.
+            template <class ForwardIterator>
+            void range_insert(iterator position, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+            {
+                size_type pos = position - this->begin();
+                size_type n = ft::distance(first, last);
+                size_type len = this->size();
+
+                if (n == 0)
+                    return ;
+                if (this->max_size() - len < n)
+                    throw std::length_error("small_vector::insert");
+                if (len + n <= this->capacity())
+                {
+                    pointer gap = this->open_gap(pos, n);
+                    size_type i = 0;
+                    try
+                    {
+                        for (; i < n; i++, ++first)
+                            this->_alloc.construct(gap + i, *first);
+                    }
+                    catch (...)
+                    {
+                        while (i--)
+                            this->_alloc.destroy(gap + i);
+                        this->relocate(gap, gap + n, len - pos);
+                        throw;
+                    }
+                    this->_end += n;
+                    return ;
+                }
+                size_type next_capacity = this->capacity() * 2;
+                if (next_capacity < len + n)
+                    next_capacity = len + n;
+                pointer new_start = this->_alloc.allocate(next_capacity);
+                size_type i = 0;
+                try
+                {
+                    for (; i < n; i++, ++first)
+                        this->_alloc.construct(new_start + pos + i, *first);
+                }
+                catch (...)
+                {
+                    while (i--)
+                        this->_alloc.destroy(new_start + pos + i);
+                    this->_alloc.deallocate(new_start, next_capacity);
+                    throw;
+                }
+                this->relocate(new_start, this->_start, pos);
+                this->relocate(new_start + pos + n, this->_start + pos, len - pos);
+                this->release();
+                this->_start = new_start;
+                this->_end = new_start + len + n;
+                this->_end_capacity = new_start + next_capacity;
+            }
+
+            // this는 객체 안에, heap은 heap에 원소가 있다.
+            void swap_with_heap(small_vector& heap)
+            {
+                pointer start = heap._start;
+                pointer end = heap._end;
+                pointer end_capacity = heap._end_capacity;
+                size_type len = this->size();
+
+                heap.reset_inline();
+                this->relocate(heap._start, this->_start, len);
+                heap._end = heap._start + len;
+                this->_start = start;
+                this->_end = end;
+                this->_end_capacity = end_capacity;
+                ft::swap(this->_alloc, heap._alloc);
+            }
+
+            void reset_inline()
+            {
+                this->_start = this->inline_data();
+                this->_end = this->_start;
+                this->_end_capacity = this->_start + N;
+            }
+
+            void release()
+            {
+                if (!this->is_inline())
+                    this->_alloc.deallocate(this->_start, this->capacity());
+            }
+
+#if __cplusplus >= 201103L
+            // 빈 inline 상태에서 불린다. x의 원소를 가져오고 x는 빈 inline 상태가 된다.
+            void take(small_vector& x)
+            {
+                if (x.is_inline())
+                {
+                    for (pointer p = x._start; p != x._end; ++p)
+                    {
+                        this->_alloc.construct(this->_end, std::move(*p));
+                        ++this->_end;
+                    }
+                    x.clear();
+                    return ;
+                }
+                this->_alloc = x._alloc;
+                this->_start = x._start;
+                this->_end = x._end;
+                this->_end_capacity = x._end_capacity;
+                x.reset_inline();
+            }
+#endif
+
+            // capacity를 n으로 바꾼다. (n >= size)
+            void reallocate(size_type n)
+            {
+                pointer new_start = this->_alloc.allocate(n);
+                size_type len = this->size();
+                this->relocate(new_start, this->_start, len);
+                this->release();
+                this->_start = new_start;
+                this->_end = new_start + len;
+                this->_end_capacity = new_start + n;
+            }
+
+            // pos 자리에 n개가 들어갈 빈 공간을 만들고 그 시작을 돌려준다. _end는 호출한 쪽이 늘린다.
+            pointer open_gap(size_type pos, size_type n)
+            {
+                if (this->max_size() - this->size() < n)
+                    throw std::length_error("small_vector::insert");
+                if (pos > this->size())
+                    throw std::out_of_range("small_vector::insert");
+                size_type len = this->size();
+                if (len + n > this->capacity())
+                {
+                    size_type next_capacity = this->capacity() * 2;
+                    if (next_capacity < len + n)
+                        next_capacity = len + n;
+                    pointer new_start = this->_alloc.allocate(next_capacity);
+                    this->relocate(new_start, this->_start, pos);
+                    this->relocate(new_start + pos + n, this->_start + pos, len - pos);
+                    this->release();
+                    this->_start = new_start;
+                    this->_end = new_start + len;
+                    this->_end_capacity = new_start + next_capacity;
+                }
+                else
+                    this->relocate(this->_start + pos + n, this->_start + pos, len - pos);
+                return this->_start + pos;
+            }
+
+            // vector::relocate와 같다. 두 구간이 겹쳐도 되고, 옮긴 뒤 src 쪽은 소멸된 상태가 된다.
+            void relocate(pointer dst, pointer src, size_type n)
+            {
+                this->relocate(dst, src, n, typename ft::is_trivially_relocatable<value_type>::type());
+            }
+
+            void relocate(pointer dst, pointer src, size_type n, ft::true_type)
+            {
+                if (n > 0 && dst != src)
+                    std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            }
+
+            void relocate(pointer dst, pointer src, size_type n, ft::false_type)
+            {
+                if (dst < src)
+                {
+                    for (size_type i = 0; i < n; i++)
+                    {
+                        this->_alloc.construct(dst + i, FT_MOVE_IF_NOEXCEPT(*(src + i)));
+                        this->_alloc.destroy(src + i);
+                    }
+                }
+                else if (dst > src)
+                {
+                    while (n--)
+                    {
+                        this->_alloc.construct(dst + n, FT_MOVE_IF_NOEXCEPT(*(src + n)));
+                        this->_alloc.destroy(src + n);
+                    }
+                }
+            }
+    };
+
+    // ===========================================Non-member function overloads===========================================
+    template <class T, std::size_t N, class Alloc>
+    bool operator== (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+    { return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+
+    template <class T, std::size_t N, class Alloc>
+    bool operator!= (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+    { return !(lhs == rhs); }
+
+    template <class T, std::size_t N, class Alloc>
+    bool operator<  (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+    { return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+    template <class T, std::size_t N, class Alloc>
+    bool operator<= (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+    { return !(rhs < lhs); }
+
+    template <class T, std::size_t N, class Alloc>
+    bool operator>  (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+    { return rhs < lhs; }
+
+    template <class T, std::size_t N, class Alloc>
+    bool operator>= (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+    { return !(lhs < rhs); }
+
+    template <class T, std::size_t N, class Alloc>
+    void swap (small_vector<T,N,Alloc>& x, small_vector<T,N,Alloc>& y)
+    { x.swap(y); }
+}
+
+#endif
@@ -2,10 +2,13 @@
 #define STACK_HPP
 
 #include "vector.hpp"
+#include "deque.hpp"
 
 namespace ft 
 {
-    template<typename T, typename Container = ft::vector<T> >
+    // std::stack처럼 기본 container는 deque다. vector는 커질 때마다 모든 원소를 복사하지만 deque는 block만 더 할당한다.
+    // push_back / pop_back / back이 있는 container(ft::vector 등)도 그대로 쓸 수 있다.
+    template<typename T, typename Container = ft::deque<T> >
     class stack
     {
         public:
@@ -21,7 +24,22 @@ namespace ft
         protected:
             container_type      c;
         public:
+#if __cplusplus >= 201103L
+            // 기본 생성자를 따로 두어야 복사할 수 없는 원소(std::unique_ptr 등)의 container도 쓸 수 있다.
+            stack (): c() {}
+            explicit stack (const container_type& ctnr): c(ctnr) {}
+            explicit stack (container_type&& ctnr): c(std::move(ctnr)) {}
+            stack (const stack&) = default;
+            stack (stack&& x): c(std::move(x.c)) {}
+            stack& operator= (const stack&) = default;
+            stack& operator= (stack&& x)
+            {
+                this->c = std::move(x.c);
+                return *this;
+            }
+#else
             explicit stack (const container_type& ctnr = container_type()): c(ctnr) {}
+#endif
             
             virtual ~stack() {}
             
@@ -50,6 +68,19 @@ namespace ft
                 return this->c.push_back(val);
             }
 
+#if __cplusplus >= 201103L
+            void push (value_type&& val)
+            {
+                this->c.push_back(std::move(val));
+            }
+
+            template <typename... Args>
+            void emplace (Args&&... args)
+            {
+                this->c.emplace_back(std::forward<Args>(args)...);
+            }
+#endif
+
             void pop()
             {
                 this->c.pop_back();
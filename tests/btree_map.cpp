@@ -0,0 +1,198 @@
+// 노드를 작게 해서(값 6개) 적은 원소로도 여러 단계의 split / merge가 일어나게 한다.
+#define FT_BTREE_NODE_BYTES 64
+
+#include <map>
+#include <vector>
+#include "btree_map.hpp"
+#include "test.hpp"
+
+typedef ft::btree_map<int, int>   ft_map;
+typedef std::map<int, int>        std_map;
+
+static bool same_reverse(const ft_map& m, const std_map& s)
+{
+    return test::same_range(m.rbegin(), m.rend(), s.rbegin(), s.rend());
+}
+
+// 정렬된 입력은 맨 끝(맨 앞) split만 타므로 따로 확인한다.
+static void insert_in_order()
+{
+    ft_map up;
+    ft_map down;
+    std_map ref;
+    for (int i = 0; i < 2000; i++)
+    {
+        up.insert(ft::make_pair(i, i * 2));
+        down.insert(ft::make_pair(1999 - i, (1999 - i) * 2));
+        ref.insert(std::make_pair(i, i * 2));
+    }
+    CHECK(test::same(up, ref));
+    CHECK(test::same(down, ref));
+    CHECK(same_reverse(down, ref));
+    CHECK(up.insert(ft::make_pair(7, 0)).second == false);
+    CHECK(up[7] == 14);
+}
+
+static void insert_and_erase_random()
+{
+    test::random rand(42);
+    ft_map m;
+    std_map ref;
+
+    for (int round = 0; round < 20; round++)
+    {
+        for (int i = 0; i < 500; i++)
+        {
+            int k = static_cast<int>(rand(3000));
+            bool inserted = m.insert(ft::make_pair(k, i)).second;
+            CHECK(inserted == ref.insert(std::make_pair(k, i)).second);
+        }
+        // 많이 지워서 노드가 모자라게 만든다. (형제와 합치기 / 빌려오기)
+        for (int i = 0; i < 450; i++)
+        {
+            int k = static_cast<int>(rand(3000));
+            CHECK(m.erase(k) == ref.erase(k));
+        }
+        CHECK(test::same(m, ref));
+        CHECK(same_reverse(m, ref));
+    }
+    while (!ref.empty())
+    {
+        int k = ref.begin()->first;
+        CHECK(m.erase(k) == 1);
+        ref.erase(k);
+    }
+    CHECK(m.empty());
+    CHECK(m.begin() == m.end());
+}
+
+// erase(iterator)는 다음 원소를 돌려줘야 한다. 값이 형제 노드로 옮겨져도 마찬가지다.
+static void erase_returns_next()
+{
+    ft_map m;
+    std_map ref;
+    for (int i = 0; i < 1000; i++)
+    {
+        m[i] = i;
+        ref[i] = i;
+    }
+    ft_map::iterator it = m.begin();
+    std_map::iterator r = ref.begin();
+    while (it != m.end())
+    {
+        if (it->first % 3 == 0)
+        {
+            it = m.erase(it);
+            ref.erase(r++);
+        }
+        else
+        {
+            ++it;
+            ++r;
+        }
+        CHECK((it == m.end()) == (r == ref.end()));
+        if (it != m.end() && r != ref.end())
+            CHECK(it->first == r->first);
+    }
+    CHECK(test::same(m, ref));
+
+    ft_map::iterator first = m.lower_bound(100);
+    ft_map::iterator last = m.lower_bound(800);
+    m.erase(first, last);
+    ref.erase(ref.lower_bound(100), ref.lower_bound(800));
+    CHECK(test::same(m, ref));
+}
+
+static void bounds()
+{
+    ft_map m;
+    std_map ref;
+    for (int i = 0; i < 600; i += 3)
+    {
+        m[i] = i;
+        ref[i] = i;
+    }
+    for (int k = -5; k < 610; k++)
+    {
+        ft_map::iterator lb = m.lower_bound(k);
+        ft_map::iterator ub = m.upper_bound(k);
+        std_map::iterator rlb = ref.lower_bound(k);
+        std_map::iterator rub = ref.upper_bound(k);
+        CHECK((lb == m.end()) == (rlb == ref.end()));
+        CHECK((ub == m.end()) == (rub == ref.end()));
+        if (lb != m.end() && rlb != ref.end())
+            CHECK(lb->first == rlb->first);
+        if (ub != m.end() && rub != ref.end())
+            CHECK(ub->first == rub->first);
+        CHECK(m.count(k) == ref.count(k));
+        CHECK((m.find(k) == m.end()) == (ref.find(k) == ref.end()));
+        ft::pair<ft_map::iterator, ft_map::iterator> range = m.equal_range(k);
+        CHECK(range.first == lb && range.second == ub);
+    }
+    const ft_map& c = m;
+    CHECK(c.find(3)->second == 3);
+    CHECK(c.lower_bound(1000) == c.end());
+}
+
+static void hint_insert()
+{
+    ft_map m;
+    std_map ref;
+    ft_map::iterator hint = m.end();
+    for (int i = 0; i < 1000; i++)
+    {
+        hint = m.insert(hint, ft::make_pair(i, i));
+        ref.insert(std::make_pair(i, i));
+    }
+    for (int i = 2000; i > 1000; i--)
+    {
+        hint = m.insert(m.begin(), ft::make_pair(-i, i));
+        ref.insert(std::make_pair(-i, i));
+    }
+    CHECK(test::same(m, ref));
+}
+
+static void copy_and_swap()
+{
+    ft_map a;
+    ft_map b;
+    std_map ra;
+    std_map rb;
+    for (int i = 0; i < 300; i++)
+    {
+        a[i] = i;
+        ra[i] = i;
+    }
+    for (int i = 0; i < 50; i++)
+    {
+        b[i * 7] = -i;
+        rb[i * 7] = -i;
+    }
+    ft_map::iterator a_first = a.begin();
+    a.swap(b);
+    CHECK(test::same(a, rb));
+    CHECK(test::same(b, ra));
+    // swap은 원소를 옮기지 않으므로 iterator는 b를 가리키게 된다.
+    CHECK(a_first == b.begin());
+
+    ft_map copy(b);
+    CHECK(test::same(copy, ra));
+    copy.erase(10);
+    CHECK(b.count(10) == 1);
+    copy = a;
+    CHECK(test::same(copy, rb));
+    copy.clear();
+    CHECK(copy.empty() && copy.size() == 0);
+    CHECK(test::same(a, rb));
+}
+
+int main()
+{
+    insert_in_order();
+    insert_and_erase_random();
+    erase_returns_next();
+    bounds();
+    hint_insert();
+    copy_and_swap();
+    return test::finish("btree_map");
+}
@@ -0,0 +1,188 @@
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "deque.hpp"
+#include "test.hpp"
+
+static void push_and_pop()
+{
+    test::random rand(3);
+    ft::deque<int> d;
+    std::deque<int> ref;
+
+    for (int i = 0; i < 50000; i++)
+    {
+        switch (rand(5))
+        {
+            case 0:
+                d.push_front(i);
+                ref.push_front(i);
+                break ;
+            case 1:
+                if (!ref.empty())
+                {
+                    d.pop_front();
+                    ref.pop_front();
+                }
+                break ;
+            case 2:
+                if (!ref.empty())
+                {
+                    d.pop_back();
+                    ref.pop_back();
+                }
+                break ;
+            default:
+                d.push_back(i);
+                ref.push_back(i);
+        }
+        if (!ref.empty())
+            CHECK(d.front() == ref.front() && d.back() == ref.back());
+    }
+    CHECK(test::same(d, ref));
+    CHECK(test::same_range(d.rbegin(), d.rend(), ref.rbegin(), ref.rend()));
+    while (!ref.empty())
+    {
+        d.pop_back();
+        ref.pop_back();
+    }
+    CHECK(d.empty() && d.begin() == d.end());
+}
+
+// 한쪽으로 넣고 반대쪽으로 빼면 원소 수는 그대로인데 map 안의 block 구간이 한쪽 끝으로 밀린다.
+// 끝에 닿으면 map을 늘리지 않고 block 포인터를 가운데로 옮겨야 한다. (reallocate_map)
+static void map_recentering()
+{
+    ft::deque<std::string> queue;
+    std::deque<std::string> ref;
+    for (int i = 0; i < 100; i++)
+    {
+        queue.push_back("x");
+        ref.push_back("x");
+    }
+    for (int i = 0; i < 100000; i++)
+    {
+        std::string s(1, static_cast<char>('a' + i % 26));
+        queue.push_back(s);
+        ref.push_back(s);
+        queue.pop_front();
+        ref.pop_front();
+    }
+    CHECK(test::same(queue, ref));
+    for (int i = 0; i < 100000; i++)
+    {
+        std::string s(1, static_cast<char>('A' + i % 26));
+        queue.push_front(s);
+        ref.push_front(s);
+        queue.pop_back();
+        ref.pop_back();
+    }
+    CHECK(test::same(queue, ref));
+    CHECK(queue[50] == ref[50]);
+}
+
+static void insert_and_erase()
+{
+    test::random rand(9);
+    ft::deque<int> d;
+    std::deque<int> ref;
+    for (int i = 0; i < 1000; i++)
+    {
+        d.push_back(i);
+        ref.push_back(i);
+    }
+    for (int i = 0; i < 300; i++)
+    {
+        std::size_t pos = rand(ref.size() + 1);
+        switch (rand(4))
+        {
+            case 0:
+                CHECK(*d.insert(d.begin() + pos, -i) == -i);
+                ref.insert(ref.begin() + pos, -i);
+                break ;
+            case 1:
+                d.insert(d.begin() + pos, 5, i);
+                ref.insert(ref.begin() + pos, 5, i);
+                break ;
+            case 2:
+            {
+                std::vector<int> values(rand(20), i);
+                d.insert(d.begin() + pos, values.begin(), values.end());
+                ref.insert(ref.begin() + pos, values.begin(), values.end());
+                break ;
+            }
+            default:
+                if (pos < ref.size())
+                {
+                    std::size_t n = rand(ref.size() - pos) % 30;
+                    d.erase(d.begin() + pos, d.begin() + pos + n);
+                    ref.erase(ref.begin() + pos, ref.begin() + pos + n);
+                    if (pos < ref.size())
+                        CHECK(*d.erase(d.begin() + pos) == *(ref.erase(ref.begin() + pos)));
+                }
+        }
+        CHECK(test::same(d, ref));
+    }
+}
+
+static void access_and_bounds()
+{
+    ft::deque<int> d;
+    for (int i = 0; i < 1000; i++)
+        d.push_front(i);
+    CHECK(d[0] == 999 && d[999] == 0 && d.at(500) == 499);
+    CHECK(d.end() - d.begin() == 1000);
+    CHECK(*(d.begin() + 700) == d[700]);
+    CHECK(*(d.end() - 1) == 0);
+    bool thrown = false;
+    try
+    {
+        d.at(1000);
+    }
+    catch (std::out_of_range&)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+    d.resize(10);
+    CHECK(d.size() == 10 && d.back() == 990);
+    d.resize(20, 7);
+    CHECK(d.size() == 20 && d.back() == 7);
+}
+
+static void copy_and_swap()
+{
+    ft::deque<int> a;
+    ft::deque<int> b;
+    std::deque<int> ra;
+    std::deque<int> rb;
+    for (int i = 0; i < 3000; i++)
+    {
+        a.push_back(i);
+        ra.push_back(i);
+    }
+    b.push_front(1);
+    rb.push_front(1);
+    ft::deque<int>::iterator a_first = a.begin();
+    a.swap(b);
+    CHECK(test::same(a, rb));
+    CHECK(test::same(b, ra));
+    CHECK(a_first == b.begin());
+    ft::deque<int> copy(b);
+    copy.pop_front();
+    CHECK(b.front() == 0);
+    copy = a;
+    CHECK(test::same(copy, rb));
+    CHECK(a == copy && !(a < copy));
+}
+
+int main()
+{
+    push_and_pop();
+    map_recentering();
+    insert_and_erase();
+    access_and_bounds();
+    copy_and_swap();
+    return test::finish("deque");
+}
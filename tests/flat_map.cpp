@@ -0,0 +1,167 @@
+#include <map>
+#include <vector>
+#include "flat_map.hpp"
+#include "test.hpp"
+
+typedef ft::flat_map<int, int>    ft_map;
+typedef std::map<int, int>        std_map;
+
+static void insert_and_erase()
+{
+    test::random rand(7);
+    ft_map m;
+    std_map ref;
+
+    for (int i = 0; i < 3000; i++)
+    {
+        int k = static_cast<int>(rand(1000));
+        if (rand(3) == 0)
+            CHECK(m.erase(k) == ref.erase(k));
+        else
+            CHECK(m.insert(ft::make_pair(k, i)).second == ref.insert(std::make_pair(k, i)).second);
+    }
+    CHECK(test::same(m, ref));
+    CHECK(test::same_range(m.rbegin(), m.rend(), ref.rbegin(), ref.rend()));
+
+    ft_map::iterator it = m.erase(m.find(ref.begin()->first));
+    ref.erase(ref.begin());
+    CHECK(it == m.begin());
+    m.erase(m.lower_bound(200), m.lower_bound(400));
+    ref.erase(ref.lower_bound(200), ref.lower_bound(400));
+    CHECK(test::same(m, ref));
+    m[5000] = 1;
+    ref[5000] = 1;
+    CHECK(test::same(m, ref));
+}
+
+// 빈 범위 erase는 빈 map에서도 아무것도 하지 않아야 한다.
+static void erase_empty_range()
+{
+    ft_map m;
+    m.erase(m.begin(), m.end());
+    CHECK(m.empty());
+    m[1] = 1;
+    m.erase(m.begin(), m.begin());
+    m.erase(m.end(), m.end());
+    CHECK(m.size() == 1);
+}
+
+// insert_deferred로 쌓은 값은 commit에서 정렬되어 합쳐지고, 같은 key는 먼저 들어간 값이 남는다. (std::map::insert와 같다)
+static void deferred_insert()
+{
+    test::random rand(11);
+    ft_map m;
+    std_map ref;
+
+    for (int round = 0; round < 10; round++)
+    {
+        for (int i = 0; i < 400; i++)
+        {
+            int k = static_cast<int>(rand(round < 5 ? 2000 : 100000));
+            m.insert_deferred(ft::make_pair(k, round * 1000 + i));
+            ref.insert(std::make_pair(k, round * 1000 + i));
+        }
+        // 쌓인 상태에서 검색하면 먼저 합친다.
+        CHECK(m.size() == ref.size());
+        CHECK(test::same(m, ref));
+    }
+    // 뒤에 붙는 값만 있을 때 (합치지 않고 중복만 지우는 경로)
+    for (int i = 0; i < 300; i++)
+    {
+        m.insert_deferred(ft::make_pair(200000 + i / 2, i));
+        ref.insert(std::make_pair(200000 + i / 2, i));
+    }
+    m.commit();
+    CHECK(test::same(m, ref));
+
+    std::vector<ft::pair<int, int> > range;
+    for (int i = 0; i < 500; i++)
+        range.push_back(ft::make_pair(static_cast<int>(rand(300000)), -i));
+    m.insert(range.begin(), range.end());
+    for (int i = 0; i < 500; i++)
+        ref.insert(std::make_pair(range[i].first, range[i].second));
+    CHECK(test::same(m, ref));
+}
+
+static void sorted_unique_insert()
+{
+    ft_map m;
+    std_map ref;
+    std::vector<ft::pair<int, int> > tail;
+    std::vector<ft::pair<int, int> > mixed;
+
+    for (int i = 0; i < 100; i++)
+    {
+        m[i * 2] = i;
+        ref[i * 2] = i;
+        tail.push_back(ft::make_pair(1000 + i, i));
+        mixed.push_back(ft::make_pair(i * 2 + 1, -i));
+    }
+    m.insert(ft::sorted_unique, tail.begin(), tail.end());
+    m.insert(ft::sorted_unique, mixed.begin(), mixed.end());
+    for (int i = 0; i < 100; i++)
+    {
+        ref.insert(std::make_pair(tail[i].first, tail[i].second));
+        ref.insert(std::make_pair(mixed[i].first, mixed[i].second));
+    }
+    CHECK(test::same(m, ref));
+}
+
+static void bounds()
+{
+    ft_map m;
+    std_map ref;
+    for (int i = 0; i < 300; i += 4)
+    {
+        m[i] = i;
+        ref[i] = i;
+    }
+    for (int k = -3; k < 305; k++)
+    {
+        ft_map::iterator lb = m.lower_bound(k);
+        ft_map::iterator ub = m.upper_bound(k);
+        CHECK((lb == m.end()) == (ref.lower_bound(k) == ref.end()));
+        CHECK((ub == m.end()) == (ref.upper_bound(k) == ref.end()));
+        if (lb != m.end())
+            CHECK(lb->first == ref.lower_bound(k)->first);
+        if (ub != m.end())
+            CHECK(ub->first == ref.upper_bound(k)->first);
+        CHECK(m.count(k) == ref.count(k));
+    }
+}
+
+static void copy_and_swap()
+{
+    ft_map a;
+    ft_map b;
+    std_map ra;
+    std_map rb;
+    for (int i = 0; i < 100; i++)
+    {
+        a[i] = i;
+        ra[i] = i;
+        b[-i] = i;
+        rb[-i] = i;
+    }
+    b.insert_deferred(ft::make_pair(-500, 0));
+    rb.insert(std::make_pair(-500, 0));
+    a.swap(b);
+    CHECK(test::same(a, rb));
+    CHECK(test::same(b, ra));
+    ft_map copy(a);
+    copy.erase(-1);
+    CHECK(a.count(-1) == 1);
+    copy = b;
+    CHECK(test::same(copy, ra));
+}
+
+int main()
+{
+    insert_and_erase();
+    erase_empty_range();
+    deferred_insert();
+    sorted_unique_insert();
+    bounds();
+    copy_and_swap();
+    return test::finish("flat_map");
+}
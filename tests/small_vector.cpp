@@ -0,0 +1,175 @@
+#include <list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "small_vector.hpp"
+#include "test.hpp"
+
+static std::string make_string(int i)
+{
+    // 짧은 문자열 최적화에 걸리지 않도록 길게 만들어서 복사 / 소멸이 실제로 일을 하게 한다.
+    std::ostringstream out;
+    out << "a string long enough to live on the heap #" << i;
+    return out.str();
+}
+
+// N개까지는 객체 안에 있고, 넘는 순간 처음으로 할당한다. (capacity N * 2)
+static void inline_to_heap()
+{
+    ft::small_vector<std::string, 4> v;
+    std::vector<std::string> ref;
+    CHECK(v.is_inline() && v.capacity() == 4);
+    for (int i = 0; i < 4; i++)
+    {
+        v.push_back(make_string(i));
+        ref.push_back(make_string(i));
+    }
+    CHECK(v.is_inline());
+    v.push_back(make_string(4));
+    ref.push_back(make_string(4));
+    CHECK(!v.is_inline() && v.capacity() == 8);
+    CHECK(test::same(v, ref));
+    for (int i = 5; i < 100; i++)
+    {
+        v.push_back(v[i % 5]);
+        ref.push_back(ref[i % 5]);
+    }
+    CHECK(test::same(v, ref));
+
+    ft::small_vector<int, 0> empty_inline;
+    CHECK(empty_inline.capacity() == 0);
+    empty_inline.push_back(1);
+    CHECK(empty_inline.size() == 1 && empty_inline[0] == 1);
+
+    // 객체 안에 있을 때의 insert가 heap으로 넘어가는 경우
+    ft::small_vector<int, 8> w(6, 1);
+    std::vector<int> wref(6, 1);
+    w.insert(w.begin() + 3, 5, 2);
+    wref.insert(wref.begin() + 3, 5, 2);
+    CHECK(!w.is_inline());
+    CHECK(test::same(w, wref));
+}
+
+static void insert_and_erase()
+{
+    test::random rand(13);
+    ft::small_vector<std::string, 6> v;
+    std::vector<std::string> ref;
+
+    for (int i = 0; i < 600; i++)
+    {
+        std::size_t pos = rand(ref.size() + 1);
+        switch (rand(5))
+        {
+            case 0:
+                CHECK(*v.insert(v.begin() + pos, make_string(i)) == make_string(i));
+                ref.insert(ref.begin() + pos, make_string(i));
+                break ;
+            case 1:
+            {
+                std::vector<std::string> values(rand(8), make_string(-i));
+                v.insert(v.begin() + pos, values.begin(), values.end());
+                ref.insert(ref.begin() + pos, values.begin(), values.end());
+                break ;
+            }
+            case 2:
+            {
+                std::list<std::string> values(rand(8), make_string(i * 2));
+                v.insert(v.begin() + pos, values.begin(), values.end());
+                ref.insert(ref.begin() + pos, values.begin(), values.end());
+                break ;
+            }
+            default:
+                if (pos < ref.size())
+                {
+                    std::size_t n = rand(ref.size() - pos) % 10;
+                    v.erase(v.begin() + pos, v.begin() + pos + n);
+                    ref.erase(ref.begin() + pos, ref.begin() + pos + n);
+                }
+        }
+        CHECK(test::same(v, ref));
+    }
+    v.clear();
+    CHECK(v.empty() && !v.is_inline());
+}
+
+// 둘 다 객체 안 / 둘 다 heap / 한쪽만 heap인 경우를 모두 지나간다.
+static void swap_all_layouts()
+{
+    const int sizes[] = { 0, 1, 3, 4, 5, 9 };
+    const int count = sizeof(sizes) / sizeof(sizes[0]);
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            ft::small_vector<std::string, 4> a;
+            ft::small_vector<std::string, 4> b;
+            std::vector<std::string> ra;
+            std::vector<std::string> rb;
+            for (int k = 0; k < sizes[i]; k++)
+            {
+                a.push_back(make_string(k));
+                ra.push_back(make_string(k));
+            }
+            for (int k = 0; k < sizes[j]; k++)
+            {
+                b.push_back(make_string(100 + k));
+                rb.push_back(make_string(100 + k));
+            }
+            a.swap(b);
+            CHECK(test::same(a, rb));
+            CHECK(test::same(b, ra));
+            CHECK(a.is_inline() == (rb.size() <= 4));
+            ft::swap(a, b);
+            CHECK(test::same(a, ra));
+            CHECK(test::same(b, rb));
+            a.push_back("after");
+            b.push_back("after");
+            ra.push_back("after");
+            rb.push_back("after");
+            CHECK(test::same(a, ra));
+            CHECK(test::same(b, rb));
+        }
+    }
+}
+
+static void access_and_bounds()
+{
+    ft::small_vector<int, 4> v;
+    for (int i = 0; i < 10; i++)
+        v.push_back(i);
+    CHECK(v.front() == 0 && v.back() == 9 && v.at(5) == 5);
+    bool thrown = false;
+    try
+    {
+        v.at(10);
+    }
+    catch (std::out_of_range&)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+    v.resize(3);
+    CHECK(v.size() == 3 && v.back() == 2);
+    v.reserve(100);
+    CHECK(v.capacity() >= 100 && v[2] == 2);
+
+    ft::small_vector<int, 4> copy(v);
+    copy[0] = 42;
+    CHECK(v[0] == 0);
+    copy = v;
+    CHECK(copy == v);
+    copy.assign(2, 7);
+    CHECK(copy.size() == 2 && copy[1] == 7);
+}
+
+int main()
+{
+    inline_to_heap();
+    insert_and_erase();
+    swap_all_layouts();
+    access_and_bounds();
+    return test::finish("small_vector");
+}
@@ -0,0 +1,72 @@
+#ifndef TEST_HPP
+#define TEST_HPP
+
+#include <iostream>
+#include <utility>
+#include "pair.hpp"
+
+// tests/ 아래 프로그램들이 같이 쓰는 검사 도구
+// 같은 연산을 ft 컨테이너와 std 컨테이너에 똑같이 하고 결과를 비교한다.
+// CHECK가 실패하면 위치를 출력하고 계속 진행하며, finish가 실패 수에 따라 종료 코드를 돌려준다.
+namespace test
+{
+    static int failures = 0;
+
+    inline void check(bool ok, const char* expr, const char* file, int line)
+    {
+        if (ok)
+            return ;
+        ++failures;
+        std::cerr << file << ":" << line << ": CHECK(" << expr << ") failed" << std::endl;
+    }
+
+    inline int finish(const char* name)
+    {
+        if (failures == 0)
+            std::cout << name << " : OK" << std::endl;
+        else
+            std::cout << name << " : " << failures << " check(s) failed" << std::endl;
+        return failures == 0 ? 0 : 1;
+    }
+
+    // ft::pair와 std::pair는 서로 비교할 수 없으므로 원소 비교를 한 곳에서 맞춘다.
+    template <typename A, typename B>
+    bool same_value(const A& a, const B& b) { return a == b; }
+
+    template <typename A1, typename A2, typename B1, typename B2>
+    bool same_value(const ft::pair<A1, A2>& a, const std::pair<B1, B2>& b) { return a.first == b.first && a.second == b.second; }
+
+    // 순서까지 같은지 본다.
+    template <typename FtIterator, typename StdIterator>
+    bool same_range(FtIterator first, FtIterator last, StdIterator std_first, StdIterator std_last)
+    {
+        for (; first != last && std_first != std_last; ++first, ++std_first)
+            if (!same_value(*first, *std_first))
+                return false;
+        return first == last && std_first == std_last;
+    }
+
+    template <typename FtContainer, typename StdContainer>
+    bool same(const FtContainer& ft_c, const StdContainer& std_c)
+    {
+        return ft_c.size() == std_c.size() && same_range(ft_c.begin(), ft_c.end(), std_c.begin(), std_c.end());
+    }
+
+    // 같은 seed면 같은 순서를 만드는 난수. rand()와 달리 다른 test와 상태를 나누지 않는다.
+    class random
+    {
+        private:
+            unsigned long _state;
+        public:
+            explicit random(unsigned long seed): _state(seed) {}
+            unsigned long operator()(unsigned long n)
+            {
+                _state = _state * 1103515245UL + 12345UL;
+                return ((_state >> 16) & 0x7FFFFFFFUL) % n;
+            }
+    };
+}
+
+#define CHECK(expr) test::check((expr), #expr, __FILE__, __LINE__)
+
+#endif
@@ -0,0 +1,231 @@
+#include <climits>
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+#include "unordered_map.hpp"
+#include "test.hpp"
+
+typedef std::map<int, int>    std_map;
+
+// 순서가 없으므로 개수와 각 값이 같은지, iterator가 모든 값을 한 번씩 지나가는지 본다.
+template <typename Map>
+static bool same_content(const Map& m, const std_map& ref)
+{
+    if (m.size() != ref.size())
+        return false;
+    std::size_t visited = 0;
+    for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it, ++visited)
+    {
+        std_map::const_iterator r = ref.find(it->first);
+        if (r == ref.end() || r->second != it->second)
+            return false;
+    }
+    if (visited != ref.size())
+        return false;
+    for (std_map::const_iterator r = ref.begin(); r != ref.end(); ++r)
+        if (m.count(r->first) != 1)
+            return false;
+    return true;
+}
+
+// 같은 home에 몰리게 해서 긴 probe 구간과 backward shift를 만든다.
+struct clustered_hash
+{
+    std::size_t operator()(int k) const { return static_cast<std::size_t>(k % 4); }
+};
+
+// hash_table은 home = mix(hash) >> shift로 정한다. mix의 곱셈을 되돌려서 mix 결과가 모든 bit가 1에 가깝게 만들면
+// 모든 key의 home이 마지막 bucket이 되어 배열 끝 뒤의 16칸(overflow tail)에 들어간다.
+struct tail_hash
+{
+    static std::size_t inverse()
+    {
+#if ULONG_MAX > 0xFFFFFFFFUL
+        std::size_t m = static_cast<std::size_t>(0x9E3779B97F4A7C15UL);
+#else
+        std::size_t m = static_cast<std::size_t>(0x9E3779B9UL);
+#endif
+        std::size_t inv = m;
+        for (int i = 0; i < 6; i++)
+            inv *= 2 - m * inv;
+        return inv;
+    }
+
+    std::size_t operator()(int k) const { return inverse() * (~static_cast<std::size_t>(0) - static_cast<std::size_t>(k)); }
+};
+
+static void insert_find_erase()
+{
+    test::random rand(5);
+    ft::unordered_map<int, int> m;
+    std_map ref;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        int k = static_cast<int>(rand(5000));
+        switch (rand(4))
+        {
+            case 0:
+                CHECK(m.erase(k) == ref.erase(k));
+                break ;
+            case 1:
+                CHECK((m.find(k) == m.end()) == (ref.find(k) == ref.end()));
+                break ;
+            default:
+                CHECK(m.insert(ft::make_pair(k, i)).second == ref.insert(std::make_pair(k, i)).second);
+        }
+    }
+    CHECK(same_content(m, ref));
+    m.clear();
+    CHECK(m.empty() && m.begin() == m.end());
+}
+
+// erase(iterator)가 돌려준 iterator로 계속 가면 남은 값을 빠짐없이 한 번씩 지나가야 한다.
+// 뒤의 값이 지운 자리로 당겨지면 그 자리를 다시 봐야 한다.
+template <typename Map>
+static void erase_while_iterating(Map& m, std_map& ref)
+{
+    std_map seen;
+    typename Map::iterator it = m.begin();
+    while (it != m.end())
+    {
+        int k = it->first;
+        seen[k]++;
+        if (k % 2 == 0)
+        {
+            it = m.erase(it);
+            ref.erase(k);
+        }
+        else
+            ++it;
+    }
+    bool once = true;
+    for (std_map::iterator s = seen.begin(); s != seen.end(); ++s)
+        once = once && s->second == 1;
+    CHECK(once);
+    CHECK(same_content(m, ref));
+}
+
+static void backward_shift()
+{
+    ft::unordered_map<int, int, clustered_hash> m;
+    std_map ref;
+    for (int i = 0; i < 200; i++)
+    {
+        m[i] = i;
+        ref[i] = i;
+    }
+    erase_while_iterating(m, ref);
+    for (int i = 1; i < 200; i += 4)
+    {
+        CHECK(m.erase(i) == ref.erase(i));
+        CHECK(same_content(m, ref));
+    }
+    ft::unordered_map<int, int> plain;
+    std_map plain_ref;
+    for (int i = 0; i < 5000; i++)
+    {
+        plain[i * 7] = i;
+        plain_ref[i * 7] = i;
+    }
+    erase_while_iterating(plain, plain_ref);
+}
+
+static void overflow_tail()
+{
+    ft::unordered_map<int, int, tail_hash> m;
+    std_map ref;
+    // home이 마지막 bucket 하나뿐이므로 그 칸과 뒤의 16칸을 넘게 넣으면 늘려도 자리가 생기지 않는다.
+    for (int i = 0; i < 12; i++)
+    {
+        m[i] = i;
+        ref[i] = i;
+    }
+    CHECK(same_content(m, ref));
+    for (int i = 0; i < 12; i += 3)
+    {
+        CHECK(m.erase(i) == 1);
+        ref.erase(i);
+        CHECK(same_content(m, ref));
+    }
+    for (int i = 0; i < 12; i += 3)
+    {
+        m[i] = -i;
+        ref[i] = -i;
+    }
+    CHECK(same_content(m, ref));
+    ft::unordered_map<int, int, tail_hash>::iterator first = m.begin();
+    ++first;
+    ++first;
+    ft::unordered_map<int, int, tail_hash>::iterator last = first;
+    ++last;
+    ++last;
+    ++last;
+    for (ft::unordered_map<int, int, tail_hash>::iterator it = first; it != last; ++it)
+        ref.erase(it->first);
+    m.erase(first, last);
+    CHECK(same_content(m, ref));
+    m.rehash(256);
+    CHECK(same_content(m, ref));
+}
+
+static void access()
+{
+    ft::unordered_map<int, int> m;
+    m[3] = 30;
+    CHECK(m.at(3) == 30);
+    CHECK(m[4] == 0 && m.size() == 2);
+    bool thrown = false;
+    try
+    {
+        m.at(5);
+    }
+    catch (std::out_of_range&)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+    const ft::unordered_map<int, int>& c = m;
+    CHECK(c.at(3) == 30);
+
+    ft::unordered_map<double, int> d;
+    d[0.0] = 1;
+    d[-0.0] = 2;
+    CHECK(d.size() == 1 && d[0.0] == 2);
+}
+
+static void copy_and_swap()
+{
+    ft::unordered_map<int, int> a;
+    ft::unordered_map<int, int> b;
+    std_map ra;
+    std_map rb;
+    for (int i = 0; i < 1000; i++)
+    {
+        a[i] = i;
+        ra[i] = i;
+    }
+    for (int i = 0; i < 10; i++)
+    {
+        b[-i] = i;
+        rb[-i] = i;
+    }
+    a.swap(b);
+    CHECK(same_content(a, rb));
+    CHECK(same_content(b, ra));
+    ft::unordered_map<int, int> copy(b);
+    copy.erase(5);
+    CHECK(b.count(5) == 1);
+    copy = a;
+    CHECK(same_content(copy, rb));
+}
+
+int main()
+{
+    insert_find_erase();
+    backward_shift();
+    overflow_tail();
+    access();
+    copy_and_swap();
+    return test::finish("unordered_map");
+}
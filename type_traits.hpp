@@ -1,7 +1,18 @@
 #ifndef TYPE_TRAITS_HPP
 #define TYPE_TRAITS_HPP
 
-#include <cstdint>
+#include <memory>
+
+// C++11 이상으로 빌드하면(make cxx11) 컨테이너에 move 생성자 / rvalue insert / emplace가 생기고,
+// 원소를 새 자리로 옮길 때 move 생성자가 noexcept면 복사 대신 move한다. C++98에서는 둘 다 그냥 복사다.
+#if __cplusplus >= 201103L
+# include <utility>
+# define FT_MOVE(x) std::move(x)
+# define FT_MOVE_IF_NOEXCEPT(x) std::move_if_noexcept(x)
+#else
+# define FT_MOVE(x) (x)
+# define FT_MOVE_IF_NOEXCEPT(x) (x)
+#endif
 
 namespace ft
 {
@@ -39,11 +50,13 @@ namespace ft
     template <>
     struct is_integral<char> : public true_type {};
 
+#if __cplusplus >= 201103L
     template <>
     struct is_integral<char16_t> : public true_type {};
 
     template <>
     struct is_integral<char32_t> : public true_type {};
+#endif
 
 	template <>
 	struct is_integral<wchar_t> : public true_type {};
@@ -60,8 +73,10 @@ namespace ft
 	template <>
 	struct is_integral<long int> : public true_type {};
 
+#if __cplusplus >= 201103L
 	template <>
-	struct is_integral<int64_t> : public true_type {};
+	struct is_integral<long long int> : public true_type {};
+#endif
 
 	template <>
 	struct is_integral<unsigned char> : public true_type {};
@@ -74,9 +89,99 @@ namespace ft
 
 	template <>
 	struct is_integral<unsigned long int> : public true_type {};
-    
+
+#if __cplusplus >= 201103L
 	template <>
-	struct is_integral<uint64_t> : public true_type {};
+	struct is_integral<unsigned long long int> : public true_type {};
+#endif
+
+    template <bool Cond>
+    struct bool_type : public false_type {};
+
+    template <>
+    struct bool_type<true> : public true_type {};
+
+    template <typename T>
+    struct is_floating_point : public false_type {};
+
+    template <>
+    struct is_floating_point<float> : public true_type {};
+
+    template <>
+    struct is_floating_point<double> : public true_type {};
+
+    template <>
+    struct is_floating_point<long double> : public true_type {};
+
+    template <typename T>
+    struct is_pointer : public false_type {};
+
+    template <typename T>
+    struct is_pointer<T*> : public true_type {};
+
+    // 복사 생성자/소멸자가 하는 일이 바이트 복사뿐인 타입 (memcpy로 복사해도 되는 타입)
+    // 기본 자료형과 포인터만 자동으로 판별하고, 사용자 구조체(POD)는 namespace ft 안에서 직접 특수화한다.
+    //   namespace ft { template <> struct is_trivially_copyable<Buffer> : public true_type {}; }
+    template <typename T>
+    struct is_trivially_copyable
+        : public bool_type<is_integral<T>::value || is_floating_point<T>::value || is_pointer<T>::value> {};
+
+    template <typename T>
+    struct is_trivially_copyable<const T> : public is_trivially_copyable<T> {};
+
+    // 기본 생성자가 아무 일도 하지 않는 타입 (초기화하지 않은 메모리를 그대로 객체로 써도 되는 타입)
+    // vector::resize_default_init이 새 원소를 만들지 않고 넘어간다. 사용자 구조체(POD)는 직접 특수화한다.
+    //   namespace ft { template <> struct is_trivially_default_constructible<Buffer> : public true_type {}; }
+    template <typename T>
+    struct is_trivially_default_constructible
+        : public bool_type<is_integral<T>::value || is_floating_point<T>::value || is_pointer<T>::value> {};
+
+    // 객체를 새 주소로 memcpy/memmove 한 뒤 원래 자리의 소멸자를 호출하지 않아도 되는 타입.
+    // trivially copyable이면 당연히 만족하고, 자기 자신을 가리키는 포인터가 없는 구조체라면
+    // 복사 생성자가 있더라도 특수화해서 opt-in 할 수 있다.
+    //   namespace ft { template <> struct is_trivially_relocatable<Buffer> : public true_type {}; }
+    template <typename T>
+    struct is_trivially_relocatable : public is_trivially_copyable<T> {};
+
+    // allocator에 pointer reallocate(pointer p, size_type old_n, size_type new_n)가 있어서
+    // buffer를 원소 단위 복사 없이 통째로 늘릴 수 있으면 true. 실패하면 0을 돌려줘야 한다. (mmap_allocator.hpp)
+    template <typename Allocator>
+    struct allocator_can_reallocate : public false_type {};
+
+    // 여러 thread에서 같은 allocator(와 그 복사본)로 동시에 allocate/deallocate해도 되면 true.
+    // rb_tree의 복사는 이게 true이고 원소가 is_parallel_copyable일 때만 큰 subtree를 worker thread에서 복제한다.
+    // pool_allocator처럼 pool을 나눠 쓰는 allocator는 false로 남겨 둔다.
+    template <typename Allocator>
+    struct allocator_is_thread_safe : public false_type {};
+
+    template <typename T>
+    struct allocator_is_thread_safe<std::allocator<T> > : public true_type {};
+
+    // 원소의 복사 생성자를 여러 thread에서 동시에 불러도 되면 true. allocator와 달리 기본값은 모두 false다.
+    // (복사 생성자가 전역 상태나 공유하는 참조 횟수를 건드릴 수 있으므로) 원하는 타입만 특수화해서 opt-in 한다.
+    // rb_tree의 복사는 allocator_is_thread_safe와 이것이 모두 true일 때만 worker thread를 쓴다. map이면 value_type은 pair<const Key, T>다.
+    //   namespace ft { template <> struct is_parallel_copyable<ft::pair<const int, int> > : public true_type {}; }
+    template <typename T>
+    struct is_parallel_copyable : public false_type {};
+
+    // Compare 안에 is_transparent 타입이 정의되어 있으면 true (ft::less<void>, C++14의 std::less<> 등)
+    // transparent comparator는 key_type이 아닌 타입(const char* 등)도 key와 바로 비교할 수 있다.
+    template <typename Compare>
+    struct is_transparent
+    {
+        private:
+            typedef char    yes;
+            typedef char    no[2];
+            template <typename C> static yes& test(typename C::is_transparent*);
+            template <typename C> static no& test(...);
+        public:
+            static const bool value = sizeof(test<Compare>(0)) == sizeof(yes);
+    };
+
+    // Compare가 transparent일 때만 R 타입이 정의된다.
+    // 조건이 K에 의존해야 멤버 함수 template의 SFINAE가 되므로 K를 같이 받는다.
+    template <typename Compare, typename K, typename R = void>
+    struct enable_if_transparent : public enable_if<is_transparent<Compare>::value, R> {};
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,184 @@
+#ifndef UNORDERED_MAP_HPP
+#define UNORDERED_MAP_HPP
+
+#include <stdexcept>
+#include "hash_table.hpp"
+
+namespace ft
+{
+    // 순서가 필요 없는 key 검색용 map. (hash_table.hpp)
+    // 값이 노드 없이 한 배열에 들어 있어서 find / operator[]가 평균 O(1)이고 cache miss가 적다.
+    // 대신 rehash가 일어나면 모든 iterator와 값의 주소가 무효가 되고, erase는 지운 자리 뒤의 값을 옮길 수 있다.
+    template <typename Key, typename T, typename Hash = ft::hash<Key>, typename Pred = ft::equal_to<Key>, typename Alloc = std::allocator<ft::pair<const Key, T> > >
+    class unordered_map
+    {
+        public:
+            typedef Key                                                                 key_type;
+            typedef T                                                                   mapped_type;
+            typedef ft::pair<const key_type, mapped_type>                               value_type;
+            typedef Hash                                                                hasher;
+            typedef Pred                                                                key_equal;
+            typedef Alloc                                                               allocator_type;
+            typedef typename allocator_type::reference                                  reference;
+            typedef typename allocator_type::const_reference                            const_reference;
+            typedef typename allocator_type::pointer                                    pointer;
+            typedef typename allocator_type::const_pointer                              const_pointer;
+            typedef typename std::ptrdiff_t                                             difference_type;
+            typedef typename std::size_t                                                size_type;
+            // hash_table은 값과 key를 둘 다 hash할 수 있어야 하므로 value의 key만 꺼내서 넘긴다.
+            class value_hash
+            {
+                friend class		unordered_map;
+
+                protected :
+                    hasher			hash;
+                    value_hash(hasher h) : hash(h) {}
+                public:
+                    std::size_t operator()(const value_type& x) const { return hash(x.first); }
+                    std::size_t operator()(const key_type& k) const { return hash(k); }
+            };
+            class value_equal
+            {
+                friend class		unordered_map;
+
+                protected :
+                    key_equal		eq;
+                    value_equal(key_equal e) : eq(e) {}
+                public:
+                    bool operator()(const value_type& x, const value_type& y) const { return eq(x.first, y.first); }
+                    bool operator()(const value_type& x, const key_type& k) const { return eq(x.first, k); }
+            };
+            typedef typename ft::hash_table<value_type, value_hash, value_equal, allocator_type>    table_type;
+            typedef typename table_type::iterator                                       iterator;
+            typedef typename table_type::const_iterator                                 const_iterator;
+        private:
+            table_type		_table;
+        public:
+            // (1) empty container constructor (default constructor)
+            // Constructs an empty unordered_map object, containing no elements, with at least n buckets.
+            explicit unordered_map (size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+                : _table(n, value_hash(hf), value_equal(eql), alloc) {}
+
+            // (2) range constructor
+            // Constructs an unordered_map object containing copies of each of the elements in the range [first,last).
+            template <class InputIterator>
+            unordered_map (InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+                : _table(n, value_hash(hf), value_equal(eql), alloc)
+            {
+                this->insert(first, last);
+            }
+
+            // (3) copy constructor
+            // The object is initialized to have the same contents and properties as the ump unordered_map object.
+            unordered_map (const unordered_map& ump): _table(ump._table) {}
+
+            ~unordered_map() {}
+
+            unordered_map& operator= (const unordered_map& ump)
+            {
+                if (this != &ump)
+                    _table = ump._table;
+                return (*this);
+            }
+#if __cplusplus >= 201103L
+            unordered_map (unordered_map&& x): _table(std::move(x._table)) {}
+            unordered_map& operator= (unordered_map&& x)
+            {
+                _table = std::move(x._table);
+                return (*this);
+            }
+#endif
+
+            // ============================================Iterators============================================
+            iterator begin() { return (_table.begin()); }
+            const_iterator begin() const { return (_table.begin()); }
+            iterator end() { return (_table.end()); }
+            const_iterator end() const { return (_table.end()); }
+
+            // =============================================Capacity=============================================
+            bool empty() const { return (_table.empty()); }
+            size_type size() const { return (_table.size()); }
+            size_type max_size() const { return (_table.max_size()); }
+
+            // ===========================================Element access===========================================
+            // 이미 있는 key라면 mapped_type을 만들지 않는다.
+            mapped_type& operator[](const key_type& k)
+            {
+                iterator it = _table.find(k);
+                if (it == this->end())
+                    it = _table.insert(value_type(k, mapped_type())).first;
+                return (*it).second;
+            }
+
+            mapped_type& at(const key_type& k)
+            {
+                iterator it = _table.find(k);
+                if (it == this->end())
+                    throw std::out_of_range("ft::unordered_map::at");
+                return (*it).second;
+            }
+            const mapped_type& at(const key_type& k) const
+            {
+                const_iterator it = _table.find(k);
+                if (it == this->end())
+                    throw std::out_of_range("ft::unordered_map::at");
+                return (*it).second;
+            }
+
+            // =============================================Modifiers=============================================
+            ft::pair<iterator, bool> insert(const value_type& x) { return (_table.insert(x)); }
+            iterator insert(const_iterator position, const value_type& x) { return (_table.insert(position, x)); }
+            template <typename InputIterator>
+            void insert(InputIterator first, InputIterator last) { return (_table.insert(first, last)); }
+            iterator erase(const_iterator position) { return (_table.erase(position)); }
+            iterator erase(iterator position) { return (_table.erase(position)); }
+            size_type erase(const key_type& x) { return (_table.erase(x)); }
+            iterator erase(const_iterator first, const_iterator last) { return (_table.erase(first, last)); }
+            void swap(unordered_map& x) { _table.swap(x._table); }
+            void clear() { _table.clear(); }
+
+            // =============================================Operations=============================================
+            iterator find(const key_type& x) { return (_table.find(x)); }
+            const_iterator find(const key_type& x) const { return (_table.find(x)); }
+            size_type count(const key_type& x) const { return (_table.count(x)); }
+            ft::pair<iterator,iterator> equal_range(const key_type& x) { return (_table.equal_range(x)); }
+            ft::pair<const_iterator,const_iterator> equal_range(const key_type& x) const { return (_table.equal_range(x)); }
+
+            // ==============================================Buckets==============================================
+            size_type bucket_count() const { return (_table.bucket_count()); }
+            float load_factor() const { return (_table.load_factor()); }
+            float max_load_factor() const { return (_table.max_load_factor()); }
+            void max_load_factor(float ml) { _table.max_load_factor(ml); }
+            void rehash(size_type n) { _table.rehash(n); }
+            void reserve(size_type n) { _table.reserve(n); }
+
+            // =============================================Observers=============================================
+            hasher hash_function() const { return (_table.hash_function().hash); }
+            key_equal key_eq() const { return (_table.value_eq().eq); }
+
+            // =============================================Allocator=============================================
+            allocator_type get_allocator() const { return _table.get_allocator(); }
+    };
+
+    // 순서와 상관없이 같은 key에 같은 값이 있으면 같다.
+    template <class Key_, class T_, class Hash_, class Pred_, class Alloc>
+    bool operator==(const ft::unordered_map<Key_,T_,Hash_,Pred_,Alloc>& x, const ft::unordered_map<Key_,T_,Hash_,Pred_,Alloc>& y)
+    {
+        if (x.size() != y.size())
+            return (false);
+        for (typename ft::unordered_map<Key_,T_,Hash_,Pred_,Alloc>::const_iterator it = x.begin(); it != x.end(); ++it)
+        {
+            typename ft::unordered_map<Key_,T_,Hash_,Pred_,Alloc>::const_iterator found = y.find(it->first);
+            if (found == y.end() || !(found->second == it->second))
+                return (false);
+        }
+        return (true);
+    }
+    template <class Key_, class T_, class Hash_, class Pred_, class Alloc>
+    bool operator!=(const ft::unordered_map<Key_,T_,Hash_,Pred_,Alloc>& x, const ft::unordered_map<Key_,T_,Hash_,Pred_,Alloc>& y) { return (!(x == y)); }
+
+    template <class Key_, class T_, class Hash_, class Pred_, class Alloc>
+    void swap(ft::unordered_map<Key_,T_,Hash_,Pred_,Alloc>& x, ft::unordered_map<Key_,T_,Hash_,Pred_,Alloc>& y) { x.swap(y); }
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef UNORDERED_SET_HPP
+#define UNORDERED_SET_HPP
+
+#include "hash_table.hpp"
+
+namespace ft
+{
+    // 순서가 필요 없는 set. (hash_table.hpp)
+    // rehash가 일어나면 모든 iterator가 무효가 되고, erase는 지운 자리 뒤의 값을 옮길 수 있다.
+    template <class Key, class Hash = ft::hash<Key>, class Pred = ft::equal_to<Key>, class Allocator = std::allocator<Key> >
+    class unordered_set
+    {
+        public:
+            typedef Key                                                                 key_type;
+            typedef Key                                                                 value_type;
+            typedef Hash                                                                hasher;
+            typedef Pred                                                                key_equal;
+            typedef Allocator                                                           allocator_type;
+            typedef typename allocator_type::reference                                  reference;
+            typedef typename allocator_type::const_reference                            const_reference;
+            typedef typename allocator_type::pointer                                    pointer;
+            typedef typename allocator_type::const_pointer                              const_pointer;
+            typedef typename ft::hash_table<key_type, hasher, key_equal, allocator_type>    table_type;
+            typedef typename table_type::const_iterator                                 iterator;
+            typedef typename table_type::const_iterator                                 const_iterator;
+            typedef typename std::ptrdiff_t                                             difference_type;
+            typedef typename std::size_t                                                size_type;
+        private:
+            table_type  _table;
+        public:
+            explicit unordered_set (size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+                : _table(n, hf, eql, alloc) {}
+            template <class InputIterator>
+            unordered_set (InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+                : _table(n, hf, eql, alloc)
+            { this->insert(first, last); }
+            unordered_set (const unordered_set& x): _table(x._table) {}
+            ~unordered_set() {}
+            unordered_set& operator=(const unordered_set& x)
+            {
+                if (this != &x)
+                    _table = x._table;
+                return (*this);
+            }
+#if __cplusplus >= 201103L
+            unordered_set (unordered_set&& x): _table(std::move(x._table)) {}
+            unordered_set& operator=(unordered_set&& x)
+            {
+                _table = std::move(x._table);
+                return (*this);
+            }
+#endif
+
+            // ============================================Iterators============================================
+            iterator begin() const { return (_table.begin()); }
+            iterator end() const { return (_table.end()); }
+
+            // =============================================Capacity=============================================
+            bool empty() const { return (_table.empty()); }
+            size_type size() const { return (_table.size()); }
+            size_type max_size() const { return (_table.max_size()); }
+
+            // =============================================Modifiers=============================================
+            ft::pair<iterator, bool> insert(const value_type& x) { return (_table.insert(x)); }
+            iterator insert(const_iterator position, const value_type& x) { return (_table.insert(position, x)); }
+            template <typename InputIterator>
+            void insert(InputIterator first, InputIterator last) { _table.insert(first, last); }
+            iterator erase(const_iterator position) { return (_table.erase(position)); }
+            size_type erase(const key_type& x) { return (_table.erase(x)); }
+            iterator erase(const_iterator first, const_iterator last) { return (_table.erase(first, last)); }
+            void swap(unordered_set& x) { _table.swap(x._table); }
+            void clear() { _table.clear(); }
+
+            // =============================================Operations=============================================
+            iterator find(const key_type& x) const { return (_table.find(x)); }
+            size_type count(const key_type& x) const { return (_table.count(x)); }
+            ft::pair<iterator,iterator> equal_range(const key_type& x) const { return (_table.equal_range(x)); }
+
+            // ==============================================Buckets==============================================
+            size_type bucket_count() const { return (_table.bucket_count()); }
+            float load_factor() const { return (_table.load_factor()); }
+            float max_load_factor() const { return (_table.max_load_factor()); }
+            void max_load_factor(float ml) { _table.max_load_factor(ml); }
+            void rehash(size_type n) { _table.rehash(n); }
+            void reserve(size_type n) { _table.reserve(n); }
+
+            // =============================================Observers=============================================
+            hasher hash_function() const { return (_table.hash_function()); }
+            key_equal key_eq() const { return (_table.value_eq()); }
+
+            // =============================================Allocator=============================================
+            allocator_type get_allocator() const { return _table.get_allocator(); }
+    };
+
+    template <class Key_, class Hash_, class Pred_, class Alloc>
+    bool operator==(const ft::unordered_set<Key_,Hash_,Pred_,Alloc>& x, const ft::unordered_set<Key_,Hash_,Pred_,Alloc>& y)
+    {
+        if (x.size() != y.size())
+            return (false);
+        for (typename ft::unordered_set<Key_,Hash_,Pred_,Alloc>::const_iterator it = x.begin(); it != x.end(); ++it)
+            if (y.find(*it) == y.end())
+                return (false);
+        return (true);
+    }
+    template <class Key_, class Hash_, class Pred_, class Alloc>
+    bool operator!=(const ft::unordered_set<Key_,Hash_,Pred_,Alloc>& x, const ft::unordered_set<Key_,Hash_,Pred_,Alloc>& y) { return (!(x == y)); }
+
+    template <class Key_, class Hash_, class Pred_, class Alloc>
+    void swap(ft::unordered_set<Key_,Hash_,Pred_,Alloc>& x, ft::unordered_set<Key_,Hash_,Pred_,Alloc>& y) { x.swap(y); }
+}
+
+#endif
@@ -3,6 +3,9 @@
 
 #include <memory>
 #include <stdexcept>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
 #include "type_traits.hpp"
 #include "algorithm.hpp"
 #include "random_access_iterator.hpp"
@@ -10,14 +13,59 @@
 
 namespace ft
 {
-    template <typename T, typename Allocator = std::allocator<T> >
+    // ==========================================Growth policies==========================================
+    // 공간이 모자랄 때 새 capacity를 정한다. required(필요한 원소 수) 이상을 돌려줘야 한다.
+    // vector의 세 번째 template 인자로 넘기거나, ft::vector_growth<T>를 특수화해서 타입마다 기본값을 바꾼다.
+    //   namespace ft { template <> struct vector_growth<Buffer> : public vector_growth_page_rounded<> {}; }
+
+    // 두 배. 재할당 횟수가 가장 적지만 마지막 재할당 뒤에 필요한 양의 2배 가까이 잡을 수 있다.
+    struct vector_growth_double
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t)
+        {
+            std::size_t next = capacity * 2;
+            return (next < required) ? required : next;
+        }
+    };
+
+    // 1.5배. 재할당은 조금 더 잦지만 남는 공간이 최대 절반이다.
+    struct vector_growth_1_5
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t)
+        {
+            std::size_t next = capacity + capacity / 2 + 1;
+            return (next < required) ? required : next;
+        }
+    };
+
+    // 1.5배로 늘리고, page보다 큰 buffer는 byte 크기를 page 단위로 올림한다.
+    // 큰 할당은 어차피 page 단위로 잡히므로(mmap) 끝에 남는 부분까지 capacity로 쓴다.
+    template <std::size_t PageSize = 4096>
+    struct vector_growth_page_rounded
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t element_size)
+        {
+            std::size_t next = vector_growth_1_5::next_capacity(capacity, required, element_size);
+            std::size_t bytes = next * element_size;
+            if (bytes >= PageSize)
+                next = ((bytes + PageSize - 1) / PageSize * PageSize) / element_size;
+            return next;
+        }
+    };
+
+    // 타입마다 기본 정책을 바꾸는 traits. 기본은 예전과 같은 두 배
+    template <typename T>
+    struct vector_growth : public vector_growth_double {};
+
+    template <typename T, typename Allocator = std::allocator<T>, typename Growth = ft::vector_growth<T> >
     class vector
     {
         private:
-            typedef vector<T, Allocator> vector_type;
+            typedef vector<T, Allocator, Growth> vector_type;
         public:
             typedef T                                                               value_type;
             typedef Allocator                                                       allocator_type;
+            typedef Growth                                                          growth_policy;
             typedef typename allocator_type::reference                              reference;
             typedef typename allocator_type::const_reference                        const_reference;
             typedef typename allocator_type::pointer                                pointer;
@@ -39,14 +87,27 @@ namespace ft
             pointer         _end;
             pointer         _end_capacity;
 
+        private:
+            // clear_some이 떼어 낸 buffer. 원소는 [start, end)에 남아 있고, released부터 끝까지의 page는 이미 OS에 돌려줬다.
+            struct detached_buffer
+            {
+                pointer     start;
+                pointer     end;
+                size_type   capacity;
+                char*       released;
+            };
+            typedef typename allocator_type::template rebind<detached_buffer>::other    detached_allocator_type;
+
+            detached_buffer*    _detached;
+
         public:
             // (1) empty container constructor (default constructor)
             // Constructs an empty container, with no elements.
-            explicit vector (const allocator_type& alloc = allocator_type()): _alloc(alloc), _start(0), _end(0), _end_capacity(0) {}
+            explicit vector (const allocator_type& alloc = allocator_type()): _alloc(alloc), _start(0), _end(0), _end_capacity(0), _detached(0) {}
             
             // (2) fill constructor
             // Constructs a container with n elements. Each element is a copy of val.
-            explicit vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()): _alloc(alloc), _start(0), _end(0), _end_capacity(0)
+            explicit vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()): _alloc(alloc), _start(0), _end(0), _end_capacity(0), _detached(0)
             {
                 this->_start = this->_alloc.allocate(n);
                 this->_end = this->_start;
@@ -60,21 +121,15 @@ namespace ft
             // enable_if는 위의 생성자의 n이 size_type이기 때문에 int인자의 경우 캐스팅이 일어나야하기 때문에 아래의 생성자가 불러짐 이를 막기 위해 (자세한 내용은 README)
             template <class InputIterator>         
             vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), 
-                        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0): _alloc(alloc)
+                        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
+                : _alloc(alloc), _start(0), _end(0), _end_capacity(0), _detached(0)
             {
-                if (&(*first) > &(*last))
-                    throw std::length_error("vector");
-                size_type n = ft::difference(first, last);
-                this->_start = this->_alloc.allocate(n);
-                this->_end = this->_start;
-                this->_end_capacity = this->_start + n;
-                while (n--)
-                    this->_alloc.construct(this->_end++, *first++);
+                this->range_init(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
             }
 
             // (4) copy constructor
             // Constructs a container with a copy of each of the elements in x, in the same order.
-            vector (const vector& x): _alloc(x._alloc)
+            vector (const vector& x): _alloc(x._alloc), _detached(0)
             {
                 size_type n = x.size();
                 this->_start = this->_alloc.allocate(n);
@@ -89,6 +144,8 @@ namespace ft
             // by the vector using its allocator.
             ~vector()
             {
+                if (this->_detached != 0)
+                    this->drop_detached();
                 this->clear();
                 this->_alloc.deallocate(this->_start, this->capacity());
                 this->_end_capacity = this->_start;
@@ -112,6 +169,35 @@ namespace ft
                     this->_alloc.construct(this->_end++, *x_start++);
                 return *this;
             }
+
+#if __cplusplus >= 201103L
+            // (5) move constructor (C++11)
+            // Constructs a container that acquires the elements of x. x is left empty.
+            vector (vector&& x) noexcept
+                : _alloc(x._alloc), _start(x._start), _end(x._end), _end_capacity(x._end_capacity), _detached(0)
+            {
+                x._start = 0;
+                x._end = 0;
+                x._end_capacity = 0;
+            }
+
+            // Moves the elements of x into the container. x is left empty.
+            vector& operator= (vector&& x) noexcept
+            {
+                if (this == &x)
+                    return *this;
+                this->clear();
+                this->_alloc.deallocate(this->_start, this->capacity());
+                this->_alloc = x._alloc;
+                this->_start = x._start;
+                this->_end = x._end;
+                this->_end_capacity = x._end_capacity;
+                x._start = 0;
+                x._end = 0;
+                x._end_capacity = 0;
+                return *this;
+            }
+#endif
             
             // ============================================Iterators============================================
 
@@ -150,6 +236,32 @@ namespace ft
                     this->insert(this->end(), n - this->size(), val);
             }
 
+            // resize(n)와 같지만 새 원소를 value-initialize하지 않는다.
+            // is_trivially_default_constructible인 타입은 새 자리를 초기화하지 않은 채로 두므로
+            // 바로 뒤에 read() 등으로 채울 때 page를 한 번만 건드린다. 그 밖의 타입은 value_type()으로 만든다.
+            void resize_default_init (size_type n)
+            {
+                if (n > this->max_size())
+                    throw std::out_of_range("vector::resize_default_init");
+                if (n < this->size())
+                    this->erase(this->begin() + n, this->end());
+                else
+                    this->append_default_init(n - this->size());
+            }
+
+            // size를 n만큼 늘리고 새 원소들의 시작 주소를 돌려준다. 원소는 resize_default_init과 같은 방법으로 만든다.
+            //   read(fd, v.append_default_init(n), n * sizeof(value_type));
+            pointer append_default_init (size_type n)
+            {
+                if (this->max_size() - this->size() < n)
+                    throw std::length_error("vector::append_default_init");
+                size_type pre_size = this->size();
+                if (this->size() + n > this->capacity())
+                    this->reserve(this->next_capacity(n));
+                this->default_init(n, typename ft::is_trivially_default_constructible<value_type>::type());
+                return this->_start + pre_size;
+            }
+
             // Returns the size of the storage space currently allocated for the vector, expressed in terms of elements.
             size_type capacity() const { return size_type(this->_end_capacity - this->_start); }
 
@@ -161,20 +273,19 @@ namespace ft
             {
                 if (n > this->max_size())
                     throw std::out_of_range("vector::reserve");
-                if (n > this->size())
+                if (n > this->capacity())
                 {
+                    if (this->reallocate(n))
+                        return ;
                     pointer pre_start = this->_start;
                     pointer pre_end = this->_end;
                     size_type pre_capacity = this->capacity();
 
                     this->_start = this->_alloc.allocate(n);
-                    this->_end = this->_start;
+                    this->_end = this->_start + (pre_end - pre_start);
                     this->_end_capacity = this->_start + n;
 
-                    for (pointer it = pre_start; it != pre_end; it++)
-                        this->_alloc.construct(this->_end++, *it);
-                    for (pointer it = pre_start; it != pre_end; it++)
-                        this->_alloc.destroy(it);
+                    this->relocate(this->_start, pre_start, pre_end - pre_start);
                     this->_alloc.deallocate(pre_start, pre_capacity);
                 }
             }
@@ -215,17 +326,7 @@ namespace ft
             void assign (InputIterator first, InputIterator last, 
                             typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
             {
-                size_type n = ft::difference(first, last);
-                this->clear();
-                if (n > this->capacity())
-                {
-                    this->_alloc.deallocate(this->_start, this->capacity());
-                    this->_start = this->_alloc.allocate(n);
-                    this->_end = this->_start;
-                    this->_end_capacity = this->_start + n;
-                }
-                while (n--)
-                    this->_alloc.construct(this->_end++, *first++);
+                this->range_assign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
             }
 
             void assign (size_type n, const value_type& val)
@@ -247,10 +348,30 @@ namespace ft
             void push_back (const value_type& val)
             {
                 if (this->_end == this->_end_capacity)
-                    this->empty() ? this->reserve(1) : this->reserve(this->capacity() * 2);
+                    this->reserve(this->next_capacity(1));
                 this->_alloc.construct(this->_end++, val);
             }
-            
+
+#if __cplusplus >= 201103L
+            void push_back (value_type&& val) { this->emplace_back(std::move(val)); }
+
+            // Inserts a new element at the end of the vector, constructed in place using args as the arguments for its constructor.
+            template <typename... Args>
+            void emplace_back (Args&&... args)
+            {
+                if (this->_end == this->_end_capacity)
+                {
+                    // args가 기존 원소를 가리킬 수도 있으므로 재할당 전에 먼저 만들어 둔다.
+                    value_type tmp(std::forward<Args>(args)...);
+                    this->reserve(this->next_capacity(1));
+                    this->_alloc.construct(this->_end, std::move(tmp));
+                }
+                else
+                    this->_alloc.construct(this->_end, std::forward<Args>(args)...);
+                ++this->_end;
+            }
+#endif
+
             // Removes the last element in the vector, effectively reducing the container size by one.
             void pop_back()
             {
@@ -269,6 +390,33 @@ namespace ft
                 return this->begin() + n;
             }
 
+#if __cplusplus >= 201103L
+            // move (4)
+            iterator insert (iterator position, value_type&& val) { return this->emplace(position, std::move(val)); }
+
+            // The container is extended by inserting a new element at position, constructed in place using args as the arguments for its construction.
+            template <typename... Args>
+            iterator emplace (iterator position, Args&&... args)
+            {
+                size_type pos = position - this->begin();
+                if (this->begin() > position || position > this->end())
+                    throw std::out_of_range("vector::emplace");
+                if (position == this->end())
+                    this->emplace_back(std::forward<Args>(args)...);
+                else
+                {
+                    // args가 뒤로 밀릴 원소를 가리킬 수도 있으므로 먼저 만들어 둔다.
+                    value_type tmp(std::forward<Args>(args)...);
+                    if (this->_end == this->_end_capacity)
+                        this->reserve(this->next_capacity(1));
+                    this->relocate(this->_start + pos + 1, this->_start + pos, this->size() - pos);
+                    this->_alloc.construct(this->_start + pos, std::move(tmp));
+                    ++this->_end;
+                }
+                return this->begin() + pos;
+            }
+#endif
+
             // fill (2)
             void insert (iterator position, size_type n, const value_type& val)
             {
@@ -281,46 +429,28 @@ namespace ft
                 {
                     if (this->capacity() >= this->size() + n)
                     {
-                        for (size_type i = 0; i < this->size() - pos; i++)
-                        {
-                            this->_alloc.construct(this->_end + (n - 1) - i, *(this->_end - i - 1));
-                            this->_alloc.destroy(this->_end - i - 1);
-                        }
+                        this->relocate(this->_start + pos + n, this->_start + pos, this->size() - pos);
                         this->_end += n;
                         for (size_type i = 0; i < n; i++)
 					        this->_alloc.construct(this->_start + pos + i, val);
                     }
                     else 
                     {
-                        // size_type next_capacity = this->size() + n;
-                        size_type next_capacity;
-                        if (n + this->size() > this->capacity() * 2)
-                            next_capacity =  this->size() + n;
-                        else
-                            next_capacity = this->capacity() * 2;
+                        size_type next_capacity = this->next_capacity(n);
 
                         pointer pre_start = this->_start;
                         size_type pre_size = this->size();
                         size_type pre_capacity = this->capacity();
 
                         this->_start = this->_alloc.allocate(next_capacity);
-                        this->_end = this->_start;
+                        this->_end = this->_start + pre_size + n;
                         this->_end_capacity = this->_start + next_capacity;
 
-                        for (size_type i = 0; i < pos; i++)
-                        {
-                            this->_alloc.construct(this->_end++, *(pre_start + i));
-				            this->_alloc.destroy(pre_start + i);
-                        }
+                        // val이 기존 원소를 참조할 수도 있으므로 기존 원소를 옮기기 전에 먼저 생성한다.
                         for (size_type i = 0; i < n; i++)
-                        {
-                            this->_alloc.construct(this->_end++, val);
-                        }
-                        for (size_type i = 0; i < pre_size - pos; i++)
-			            {
-                            this->_alloc.construct(this->_end++, *(pre_start + pos + i));
-				            this->_alloc.destroy(pre_start + pos + i);
-                        }
+                            this->_alloc.construct(this->_start + pos + i, val);
+                        this->relocate(this->_start, pre_start, pos);
+                        this->relocate(this->_start + pos + n, pre_start + pos, pre_size - pos);
                         this->_alloc.deallocate(pre_start, pre_capacity);
                     }
                 }
@@ -331,98 +461,29 @@ namespace ft
             void insert (iterator position, InputIterator first, InputIterator last,
                             typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL)
             {
-                size_type pos = position - this->begin();
-                size_type n = ft::difference(first, last);
-
-                if (this->begin() > position || position > this->end() || &(*first) > &(*last))
+                if (this->begin() > position || position > this->end())
                     throw std::out_of_range("vector::insert");
-                if (max_size() - this->size() < n)
-                    throw std::length_error ("vector::insert");
-                if (n > 0)
-                {
-                    if (this->capacity() >= this->size() + n)
-                    {
-                        for (size_type i = 0; i < this->size() - pos; i++)
-                        {
-                            this->_alloc.construct(this->_end + (n - 1) - i, *(this->_end - i - 1));
-                            this->_alloc.destroy(this->_end - i - 1);
-                        }
-                        this->_end += n;
-                        for (size_type i = 0; i < n; i++, first++)
-					        this->_alloc.construct(this->_start + pos + i, *first);
-                    }
-                    else
-                    {
-                        // size_type next_capacity = this->size() + n;
-                        size_type next_capacity;
-                        if (n + this->size() > this->capacity() * 2)
-                            next_capacity =  this->size() + n;
-                        else
-                            next_capacity = this->capacity() * 2;
-
-                        pointer pre_start = this->_start;
-                        size_type pre_size = this->size();
-                        size_type pre_capacity = this->capacity();
-
-                        this->_start = this->_alloc.allocate(next_capacity);
-                        this->_end = this->_start;
-                        this->_end_capacity = this->_start + next_capacity;
-                        try
-                        {
-                            for (size_type i = 0; i < pos; i++)
-                            {
-                                this->_alloc.construct(this->_end++, *(pre_start + i));
-                                this->_alloc.destroy(pre_start + i);
-                            }
-                            for (size_type i = 0; i < n; i++, *first++)
-                            {
-                                this->_alloc.construct(this->_end++, *first);
-                            }
-                            for (size_type i = 0; i < pre_size - pos; i++)
-                            {
-                                this->_alloc.construct(this->_end++, *(pre_start + pos + i));
-                                this->_alloc.destroy(pre_start + pos + i);
-                            }
-                        }
-                        catch(...)
-                        {
-                            this->clear();
-                            this->_end_capacity = this->_start;
-                            throw;
-                        }         
-                        this->_alloc.deallocate(pre_start, pre_capacity);
-                    }
-                }
+                this->range_insert(position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
             }
 
             // Removes from the vector either a single element (position) or a range of elements ([first,last)). 
             iterator erase (iterator position)
             {
                 pointer pos = &(*position);
-                if (position + 1 != this->end())
-                {
-                    for (pointer p = pos; p + 1 != this->_end; p++)
-                    {
-                        this->_alloc.destroy(p);
-                        this->_alloc.construct(p, *(p + 1));
-                    }
-                }
+                this->_alloc.destroy(pos);
+                this->relocate(pos, pos + 1, this->_end - pos - 1);
                 this->_end--;
-                this->_alloc.destroy(this->_end);
                 return (iterator(pos));
             }
             
             iterator erase (iterator first, iterator last)
             {
                 pointer p_first = &(*first);
-                for (; &(*first) != &(*last); first++)
-                    this->_alloc.destroy(&(*first));
-                for (int i = 0; i < this->_end - &(*last); i++)
-                {
-                    this->_alloc.construct(p_first + i, *(&(*last) + i));
-                    this->_alloc.destroy(&(*last) + i);
-                }
-                this->_end -= (&(*last) - p_first);
+                pointer p_last = &(*last);
+                for (pointer p = p_first; p != p_last; p++)
+                    this->_alloc.destroy(p);
+                this->relocate(p_first, p_last, this->_end - p_last);
+                this->_end -= (p_last - p_first);
                 return iterator(p_first);
             }
 
@@ -435,6 +496,8 @@ namespace ft
                 ft::swap(this->_start, x._start);
                 ft::swap(this->_end, x._end);
                 ft::swap(this->_end_capacity, x._end_capacity);
+                // buffer는 자신을 할당한 allocator로 돌려줘야 하므로 allocator도 같이 바꾼다. (pool_allocator)
+                ft::swap(this->_alloc, x._alloc);
             }
 
 
@@ -445,6 +508,31 @@ namespace ft
 				this->_alloc.destroy(--this->_end);
         }
 
+        // Empties the vector at once and releases its old contents over several calls.
+        // The first call moves the elements and storage aside, so the vector is empty (and usable) right away.
+        // Each call then does at most budget units of work: destroying one element or returning one page of storage counts as one.
+        // Returns true when nothing is left to free.
+        // 큰 vector를 한 번에 비우지 않고 여러 번에 나눠 비울 때 쓴다. (ft::reclaim은 reclaimer.hpp)
+        // 떼어 낸 buffer는 원소를 뒤에서부터 소멸시키고, 비워진 page는 madvise(MADV_DONTNEED)로 먼저 돌려준다.
+        // 마지막 deallocate는 page가 거의 남지 않은 buffer를 반납하므로 짧다.
+        bool clear_some(size_type budget)
+        {
+            if (this->_detached == 0)
+            {
+                if (this->_start == 0)
+                    return true;
+                this->detach();
+            }
+            detached_buffer* d = this->_detached;
+            for (; budget > 0 && d->end != d->start; budget--)
+                this->_alloc.destroy(--d->end);
+            budget = this->release_pages(d, budget);
+            if (budget == 0)
+                return false;
+            this->drop_detached();
+            return this->_start == 0;
+        }
+
         // ===========================================Allocator===========================================
 
         // Returns a copy of the allocator object associated with the vector.
@@ -452,6 +540,266 @@ namespace ft
 		{
 			return this->_alloc;
 		}
+
+        private:
+            // 내용을 _detached로 옮기고 빈 vector가 된다.
+            void detach()
+            {
+                detached_allocator_type alloc(this->_alloc);
+                detached_buffer* d = alloc.allocate(1);
+                d->start = this->_start;
+                d->end = this->_end;
+                d->capacity = this->capacity();
+                d->released = page_floor(reinterpret_cast<char*>(this->_end_capacity));
+                this->_detached = d;
+                this->_start = 0;
+                this->_end = 0;
+                this->_end_capacity = 0;
+            }
+
+            // 남은 원소 뒤의 온전한 page를 뒤에서부터 최대 budget개 돌려주고, 쓰고 남은 budget을 돌려준다.
+            // buffer 안에 완전히 들어가는 page만 건드리므로 같은 page를 쓰는 다른 할당이 없다. 내용은 다시 읽지 않는다.
+            static size_type release_pages(detached_buffer* d, size_type budget)
+            {
+#ifdef MADV_DONTNEED
+                char* used = page_ceil(reinterpret_cast<char*>(d->end));
+                size_type pages = (d->released > used) ? (d->released - used) / page_size() : 0;
+                if (pages > budget)
+                    pages = budget;
+                if (pages > 0)
+                {
+                    d->released -= pages * page_size();
+                    madvise(d->released, pages * page_size(), MADV_DONTNEED);
+                }
+                return budget - pages;
+#else
+                (void)d;
+                return budget;
+#endif
+            }
+
+            // 떼어 낸 buffer에 남은 원소를 소멸시키고 buffer를 반납한다.
+            void drop_detached()
+            {
+                detached_buffer* d = this->_detached;
+                while (d->end != d->start)
+                    this->_alloc.destroy(--d->end);
+                this->_alloc.deallocate(d->start, d->capacity);
+                detached_allocator_type alloc(this->_alloc);
+                alloc.deallocate(d, 1);
+                this->_detached = 0;
+            }
+
+            static std::size_t page_size()
+            {
+                static const std::size_t page = sysconf(_SC_PAGESIZE);
+                return page;
+            }
+
+            static char* page_floor(char* p)
+            {
+                return p - reinterpret_cast<std::size_t>(p) % page_size();
+            }
+
+            static char* page_ceil(char* p)
+            {
+                return page_floor(p + page_size() - 1);
+            }
+
+            // 원소 n개를 더 넣을 때의 새 capacity (growth_policy가 정한다)
+            size_type next_capacity(size_type n) const
+            {
+                return growth_policy::next_capacity(this->capacity(), this->size() + n, sizeof(value_type));
+            }
+
+            // range constructor / assign / range insert는 iterator_category로 나눈다.
+            // input iterator(istream_iterator 등)는 한 번밖에 못 읽으므로 길이를 세지 않고 push_back으로 늘려 가고,
+            // forward iterator 이상은 ft::distance로 길이를 먼저 구해서 한 번에 할당한다(random access면 O(1)).
+            template <class InputIterator>
+            void range_init(InputIterator first, InputIterator last, ft::input_iterator_tag)
+            {
+                try
+                {
+                    for (; first != last; ++first)
+                        this->push_back(*first);
+                }
+                catch(...)
+                {
+                    this->clear();
+                    this->_alloc.deallocate(this->_start, this->capacity());
+                    throw;
+                }
+            }
+
+            template <class ForwardIterator>
+            void range_init(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+            {
+                size_type n = ft::distance(first, last);
+                this->_start = this->_alloc.allocate(n);
+                this->_end = this->_start;
+                this->_end_capacity = this->_start + n;
+                while (n--)
+                    this->_alloc.construct(this->_end++, *first++);
+            }
+
+            template <class InputIterator>
+            void range_assign(InputIterator first, InputIterator last, ft::input_iterator_tag)
+            {
+                this->clear();
+                for (; first != last; ++first)
+                    this->push_back(*first);
+            }
+
+            template <class ForwardIterator>
+            void range_assign(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+            {
+                size_type n = ft::distance(first, last);
+                this->clear();
+                if (n > this->capacity())
+                {
+                    this->_alloc.deallocate(this->_start, this->capacity());
+                    this->_start = this->_alloc.allocate(n);
+                    this->_end = this->_start;
+                    this->_end_capacity = this->_start + n;
+                }
+                while (n--)
+                    this->_alloc.construct(this->_end++, *first++);
+            }
+
+            // 끝에 붙일 때는 바로 push_back 하고, 중간이면 한 번 읽어서 모아 둔 뒤 forward iterator로 넣는다.
+            template <class InputIterator>
+            void range_insert(iterator position, InputIterator first, InputIterator last, ft::input_iterator_tag)
+            {
+                if (position == this->end())
+                {
+                    for (; first != last; ++first)
+                        this->push_back(*first);
+                    return ;
+                }
+                vector values(first, last, this->_alloc);
+                this->range_insert(position, values.begin(), values.end(), ft::random_access_iterator_tag());
+            }
+
+            template <class ForwardIterator>
+            void range_insert(iterator position, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+            {
+                size_type pos = position - this->begin();
+                size_type n = ft::distance(first, last);
+
+                if (max_size() - this->size() < n)
+                    throw std::length_error ("vector::insert");
+                if (n > 0)
+                {
+                    if (this->capacity() >= this->size() + n)
+                    {
+                        this->relocate(this->_start + pos + n, this->_start + pos, this->size() - pos);
+                        this->_end += n;
+                        for (size_type i = 0; i < n; i++, first++)
+					        this->_alloc.construct(this->_start + pos + i, *first);
+                    }
+                    else
+                    {
+                        size_type next_capacity = this->next_capacity(n);
+
+                        pointer pre_start = this->_start;
+                        size_type pre_size = this->size();
+                        size_type pre_capacity = this->capacity();
+
+                        pointer new_start = this->_alloc.allocate(next_capacity);
+                        size_type i = 0;
+                        try
+                        {
+                            for (; i < n; i++, first++)
+                                this->_alloc.construct(new_start + pos + i, *first);
+                        }
+                        catch(...)
+                        {
+                            while (i--)
+                                this->_alloc.destroy(new_start + pos + i);
+                            this->_alloc.deallocate(new_start, next_capacity);
+                            throw;
+                        }
+                        this->relocate(new_start, pre_start, pos);
+                        this->relocate(new_start + pos + n, pre_start + pos, pre_size - pos);
+                        this->_start = new_start;
+                        this->_end = new_start + pre_size + n;
+                        this->_end_capacity = new_start + next_capacity;
+                        this->_alloc.deallocate(pre_start, pre_capacity);
+                    }
+                }
+            }
+
+            // _end 뒤에 원소 n개를 만든다. capacity는 충분해야 한다.
+            void default_init(size_type n, ft::true_type)
+            {
+                this->_end += n;
+            }
+
+            void default_init(size_type n, ft::false_type)
+            {
+                while (n--)
+                {
+                    this->_alloc.construct(this->_end, value_type());
+                    ++this->_end;
+                }
+            }
+
+            // allocator가 buffer를 통째로 늘려줄 수 있으면(mmap_allocator의 mremap) 원소를 하나씩 옮기지 않는다.
+            // byte 단위로 옮겨지므로 trivially relocatable한 원소일 때만 쓰고, 못 했으면 false
+            bool reallocate(size_type n)
+            {
+                return this->reallocate(n, typename ft::bool_type<ft::is_trivially_relocatable<value_type>::value
+                                                    && ft::allocator_can_reallocate<allocator_type>::value>::type());
+            }
+
+            bool reallocate(size_type n, ft::true_type)
+            {
+                size_type pre_size = this->size();
+                pointer new_start = this->_alloc.reallocate(this->_start, this->capacity(), n);
+                if (new_start == 0)
+                    return false;
+                this->_start = new_start;
+                this->_end = new_start + pre_size;
+                this->_end_capacity = new_start + n;
+                return true;
+            }
+
+            bool reallocate(size_type, ft::false_type) { return false; }
+
+            // [src, src + n)의 원소들을 dst로 옮긴다. 옮긴 뒤 src 쪽 원소는 소멸된 상태가 된다.
+            // 두 구간이 겹쳐도 되며(insert/erase의 shift), trivially relocatable 타입은 memmove 한 번으로 처리한다.
+            // memmove가 빨라지는 것은 복사 생성자 / 소멸자가 일을 하는데 opt-in 한 타입이다. trivially copyable 타입은
+            // 원소별 loop도 -O2에서 같은 코드가 되어 차이가 잡음 수준이다. (benchmarks/vector_relocate.cpp)
+            void relocate(pointer dst, pointer src, size_type n)
+            {
+                this->relocate(dst, src, n, typename ft::is_trivially_relocatable<value_type>::type());
+            }
+
+            void relocate(pointer dst, pointer src, size_type n, ft::true_type)
+            {
+                if (n > 0 && dst != src)
+                    std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            }
+
+            void relocate(pointer dst, pointer src, size_type n, ft::false_type)
+            {
+                if (dst < src)
+                {
+                    for (size_type i = 0; i < n; i++)
+                    {
+                        this->_alloc.construct(dst + i, FT_MOVE_IF_NOEXCEPT(*(src + i)));
+                        this->_alloc.destroy(src + i);
+                    }
+                }
+                else if (dst > src)
+                {
+                    while (n--)
+                    {
+                        this->_alloc.construct(dst + n, FT_MOVE_IF_NOEXCEPT(*(src + n)));
+                        this->_alloc.destroy(src + n);
+                    }
+                }
+            }
     };
 
     // ===========================================Non-member function overloads===========================================
@@ -463,34 +811,34 @@ namespace ft
 
     // The less-than comparison (operator<) behaves as if using algorithm lexicographical_compare, 
     // which compares the elements sequentially using operator< in a reciprocal manner (i.e., checking both a<b and b<a) and stopping at the first occurrence.
-    template <class T, class Alloc>  
-    bool operator== (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs)
+    template <class T, class Alloc, class Growth>
+    bool operator== (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs)
     { return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
 
-    template <class T, class Alloc>  
-    bool operator!= (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs)
+    template <class T, class Alloc, class Growth>
+    bool operator!= (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs)
     { return !(lhs == rhs); }
 
-    template <class T, class Alloc>
-    bool operator<  (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs)
+    template <class T, class Alloc, class Growth>
+    bool operator<  (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs)
     { return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
 
-    template <class T, class Alloc>
-    bool operator<= (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs)
+    template <class T, class Alloc, class Growth>
+    bool operator<= (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs)
     { return !(rhs < lhs); }
 
-    template <class T, class Alloc>
-    bool operator>  (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs)
+    template <class T, class Alloc, class Growth>
+    bool operator>  (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs)
     { return rhs < lhs; }
 
-    template <class T, class Alloc>  
-    bool operator>= (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs)
+    template <class T, class Alloc, class Growth>
+    bool operator>= (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs)
     { return !(lhs < rhs); }
 
     // The contents of container x are exchanged with those of y. 
     // Both container objects must be of the same type (same template parameters), although sizes may differ.
-    template <class T, class Alloc>  
-    void swap (vector<T,Alloc>& x, vector<T,Alloc>& y)
+    template <class T, class Alloc, class Growth>
+    void swap (vector<T,Alloc,Growth>& x, vector<T,Alloc,Growth>& y)
     { x.swap(y); }
 }
 